@@ -7,15 +7,28 @@
 #include "core/globals.h"
 // Micropython imports
 #include "micropython/micropython.h"
+extern "C" {
+#include "py/binary.h"
+}
 // Pythonscript imports
 #include "bindings/binder.h"
 #include "bindings/dynamic_binder.h"
+#include "bindings/bulk.h"
+#include "py_perf.h"
+#include "py_startup.h"
 #include "bindings/builtins_binder/atomic.h"
 #include "bindings/builtins_binder/vector2.h"
 #include "bindings/builtins_binder/vector3.h"
+#include "bindings/builtins_binder/rect2.h"
+#include "bindings/builtins_binder/rect3.h"
+#include "bindings/builtins_binder/plane.h"
+#include "bindings/builtins_binder/color.h"
+#include "bindings/builtins_binder/node_path.h"
+#include "bindings/builtins_binder/rid.h"
 
 
-void init_bindings() {
+void init_bindings(bool p_lazy) {
+    uint64_t phase_start = PyStartupTimings::now();
     GodotBindingsModule::init();
     NilBinder::init();
     BoolBinder::init();
@@ -24,14 +37,102 @@ void init_bindings() {
     StringBinder::init();
     Vector2Binder::init();
     Vector3Binder::init();
-    // TODO: make this lazy ?
-    GodotBindingsModule::get_singleton()->build_binders();
+    Rect2Binder::init();
+    PlaneBinder::init();
+    Rect3Binder::init();
+    ColorBinder::init();
+    NodePathBinder::init();
+    RIDBinder::init();
+    PyStartupTimings::record("init_bindings", phase_start);
+    phase_start = PyStartupTimings::now();
+    GodotBindingsModule::get_singleton()->build_binders(p_lazy);
+    PyStartupTimings::record("build_binders", phase_start);
+}
+
+
+// Core singletons are exposed through a `_`-prefixed wrapper class
+// (e.g. `_OS`), servers (e.g. `VisualServer`) are bound directly
+static const struct {
+    const char *name;
+    const char *store_name;
+} _global_singletons[] = {
+    { "AudioServer", "AS" },
+    { "AudioServer", "AudioServer" },
+    { "Geometry", "Geometry" },
+    { "GlobalConfig", "GlobalConfig" },
+    { "IP", "IP" },
+    { "Input", "Input" },
+    { "InputMap", "InputMap" },
+    { "Marshalls", "Marshalls" },
+    { "OS", "OS" },
+    { "Engine", "Engine" },
+    { "ClassDB", "ClassDB" },
+    { "PhysicsServer", "PS" },
+    { "Physics2DServer", "PS2D" },
+    { "PathRemap", "PathRemap" },
+    { "Performance", "Performance" },
+    { "Physics2DServer", "Physics2DServer" },
+    { "PhysicsServer", "PhysicsServer" },
+    { "ResourceLoader", "ResourceLoader" },
+    { "ResourceSaver", "ResourceSaver" },
+    { "SpatialSoundServer", "SS" },
+    { "SpatialSound2DServer", "SS2D" },
+    { "SpatialSound2DServer", "SpatialSound2DServer" },
+    { "SpatialSoundServer", "SpatialSoundServer" },
+    { "TranslationServer", "TS" },
+    { "TranslationServer", "TranslationServer" },
+    { "VisualServer", "VS" },
+    { "VisualServer", "VisualServer" },
+    { "PythonScriptStats", "PythonScriptStats" },
+    { NULL, NULL }
+};
+
+
+// With lazy bindings, `godot.bindings` is a module-like object binding
+// Godot classes, singletons and constants the first time they are accessed
+static void _lazy_module_print(const mp_print_t *print, mp_obj_t self_in, mp_print_kind_t kind) {
+    mp_printf(print, "<module 'godot.bindings'>");
 }
 
 
+static void _lazy_module_attr(mp_obj_t self_in, qstr attr, mp_obj_t *dest) {
+    mp_obj_module_t *self = static_cast<mp_obj_module_t *>(MP_OBJ_TO_PTR(self_in));
+    if (dest[0] == MP_OBJ_NULL) {
+        // load attribute
+        mp_map_elem_t *elem = mp_map_lookup(&self->globals->map, MP_OBJ_NEW_QSTR(attr), MP_MAP_LOOKUP);
+        if (elem != NULL) {
+            dest[0] = elem->value;
+        } else {
+            mp_obj_t value = GodotBindingsModule::get_singleton()->bind_attr(attr);
+            if (value != MP_OBJ_NULL) {
+                dest[0] = value;
+            }
+        }
+    } else {
+        // delete/store attribute
+        if (dest[1] == MP_OBJ_NULL) {
+            mp_obj_dict_delete(MP_OBJ_FROM_PTR(self->globals), MP_OBJ_NEW_QSTR(attr));
+        } else {
+            mp_obj_dict_store(MP_OBJ_FROM_PTR(self->globals), MP_OBJ_NEW_QSTR(attr), dest[1]);
+        }
+        dest[0] = MP_OBJ_NULL; // indicate success
+    }
+}
+
+
+static const mp_obj_type_t _lazy_module_type = {
+    { &mp_type_type },                        // base
+    MP_QSTR_module,                           // name
+    _lazy_module_print,                       // print
+    0,                                        // make_new
+    0,                                        // call
+    0,                                        // unary_op
+    0,                                        // binary_op
+    _lazy_module_attr,                        // attr
+};
+
+
 GodotBindingsModule::GodotBindingsModule() {
-    // TODO: don't use micropython memory mangement for this
-    this->_mp_module = mp_obj_new_module(qstr_from_str("godot.bindings"));
 }
 
 
@@ -42,73 +143,123 @@ GodotBindingsModule::~GodotBindingsModule() {
 }
 
 
-void GodotBindingsModule::build_binders() {
-    MP_WRAP_CALL([this]() {
+void GodotBindingsModule::_new_module(bool p_lazy) {
+    // TODO: don't use micropython memory mangement for this
+    const qstr name = qstr_from_str("godot.bindings");
+    if (!p_lazy) {
+        this->_mp_module = mp_obj_new_module(name);
+        return;
+    }
+    // Same layout and registration than `mp_obj_new_module`
+    mp_obj_module_t *module = m_new_obj(mp_obj_module_t);
+    module->base.type = &_lazy_module_type;
+    module->globals = static_cast<mp_obj_dict_t *>(MP_OBJ_TO_PTR(mp_obj_new_dict(MICROPY_MODULE_DICT_SIZE)));
+    mp_obj_dict_store(MP_OBJ_FROM_PTR(module->globals), MP_OBJ_NEW_QSTR(MP_QSTR___name__), MP_OBJ_NEW_QSTR(name));
+    this->_mp_module = MP_OBJ_FROM_PTR(module);
+    mp_obj_dict_store(MP_OBJ_FROM_PTR(&MP_STATE_VM(mp_loaded_modules_dict)), MP_OBJ_NEW_QSTR(name), this->_mp_module);
+}
+
+
+void GodotBindingsModule::_store_binder(BaseBinder *p_binder) const {
+    const mp_obj_type_t *type = p_binder->get_mp_type();
+    mp_store_attr(this->_mp_module, type->name, MP_OBJ_FROM_PTR(type));
+    this->_binders.push_back(p_binder);
+    this->_binders_per_name.insert(p_binder->get_type_name(), p_binder);
+    if (!this->_binders_per_qstr.has(type->name)) {
+        this->_binders_per_qstr.insert(type->name, p_binder);
+    }
+}
+
+
+mp_obj_t GodotBindingsModule::_bind_singleton(const char *p_name, const char *p_store_name) const {
+    auto binder = static_cast<const DynamicBinder *>(this->get_binder(String("_") + p_name));
+    if (!binder) {
+        binder = static_cast<const DynamicBinder *>(this->get_binder(p_name));
+    }
+    Object *singleton = GlobalConfig::get_singleton()->get_singleton_object(p_name);
+    if (!binder) {
+        WARN_PRINTS(String("Cannot retrieve binding `_") + p_name + "` nor `" + p_name + "`");
+    } else if (!singleton) {
+        WARN_PRINTS(String("Cannot retrieve global singleton `") + p_store_name + "`");
+    } else {
+        mp_obj_t pyobj = binder->build_pyobj(singleton);
+        mp_store_attr(this->_mp_module, qstr_from_str(p_store_name), MP_OBJ_FROM_PTR(pyobj));
+        return pyobj;
+    }
+    return MP_OBJ_NULL;
+}
+
+
+mp_obj_t GodotBindingsModule::bind_attr(qstr p_attr) const {
+    const char *attr = qstr_str(p_attr);
 
-        #define STORE_BINDED_TYPE(binder) { \
-                const mp_obj_type_t *type = binder->get_mp_type(); \
-                mp_store_attr(this->_mp_module, type->name, MP_OBJ_FROM_PTR(type)); \
-                this->_binders.push_back(binder); \
+    // Singletons such as `VisualServer` share their name with their class,
+    // the module exposes the instance like in eager mode
+    for (int i = 0; _global_singletons[i].name; ++i) {
+        if (!strcmp(_global_singletons[i].store_name, attr)) {
+            return this->_bind_singleton(_global_singletons[i].name, _global_singletons[i].store_name);
         }
+    }
+
+    const StringName type = attr;
+    if (ClassDB::class_exists(type)) {
+        return MP_OBJ_FROM_PTR(this->get_binder(type)->get_mp_type());
+    }
+
+    const int count = GlobalConstants::get_global_constant_count();
+    for (int i = 0; i < count; ++i) {
+        if (!strcmp(GlobalConstants::get_global_constant_name(i), attr)) {
+            mp_obj_t value = IntBinder::get_singleton()->build_pyobj(GlobalConstants::get_global_constant_value(i));
+            mp_store_attr(this->_mp_module, p_attr, value);
+            return value;
+        }
+    }
+
+    return MP_OBJ_NULL;
+}
+
+
+void GodotBindingsModule::build_binders(bool p_lazy) {
+    MP_WRAP_CALL([this, p_lazy]() {
+
+        this->_new_module(p_lazy);
 
         // Bind builtins bindings
-        STORE_BINDED_TYPE(NilBinder::get_singleton());
-        STORE_BINDED_TYPE(BoolBinder::get_singleton());
-        STORE_BINDED_TYPE(IntBinder::get_singleton());
-        STORE_BINDED_TYPE(RealBinder::get_singleton());
-        STORE_BINDED_TYPE(StringBinder::get_singleton());
-        STORE_BINDED_TYPE(Vector2Binder::get_singleton());
-        STORE_BINDED_TYPE(Vector3Binder::get_singleton());
+        this->_store_binder(NilBinder::get_singleton());
+        this->_store_binder(BoolBinder::get_singleton());
+        this->_store_binder(IntBinder::get_singleton());
+        this->_store_binder(RealBinder::get_singleton());
+        this->_store_binder(StringBinder::get_singleton());
+        this->_store_binder(Vector2Binder::get_singleton());
+        this->_store_binder(Vector3Binder::get_singleton());
+        this->_store_binder(Rect2Binder::get_singleton());
+        this->_store_binder(Rect3Binder::get_singleton());
+        this->_store_binder(PlaneBinder::get_singleton());
+        this->_store_binder(ColorBinder::get_singleton());
+        this->_store_binder(NodePathBinder::get_singleton());
+        this->_store_binder(RIDBinder::get_singleton());
         // TODO: finish builtins
 
+        // Bind native helpers
+        bind_bulk_functions(this->_mp_module);
+
+        if (p_lazy) {
+            // Everything else is bound on first access by `bind_attr`
+            return;
+        }
+
         // Dynamically bind modules registered through ClassDB
+        // (`get_binder` binds the class along with its parents)
         List<StringName> classes;
         ClassDB::get_class_list(&classes);
         for(auto E=classes.front(); E; E=E->next()) {
-            auto binder = memnew(DynamicBinder(E->get()));
-            STORE_BINDED_TYPE(binder);
+            this->get_binder(E->get());
         }
 
         // Bind global singletons
-        #define STORE_GLOBAL_SINGLETON(NAME, STORE_NAME) { \
-            auto binder = static_cast<const DynamicBinder *>(this->get_binder("_"#NAME)); \
-            Object *singleton = GlobalConfig::get_singleton()->get_singleton_object(#NAME); \
-            if (!binder) { \
-                WARN_PRINTS("Cannot retrieve binding `_" #NAME "`"); \
-            } else if (!singleton) { \
-                WARN_PRINTS("Cannot retrieve global singleton `" #STORE_NAME "`"); \
-            } else { \
-                mp_obj_t pyobj = binder->build_pyobj(singleton); \
-                mp_store_attr(this->_mp_module, qstr_from_str(#STORE_NAME), MP_OBJ_FROM_PTR(pyobj)); \
-            } \
+        for (int i = 0; _global_singletons[i].name; ++i) {
+            this->_bind_singleton(_global_singletons[i].name, _global_singletons[i].store_name);
         }
-        STORE_GLOBAL_SINGLETON(AudioServer, AS);
-        STORE_GLOBAL_SINGLETON(AudioServer, AudioServer);
-        STORE_GLOBAL_SINGLETON(Geometry, Geometry);
-        STORE_GLOBAL_SINGLETON(GlobalConfig, GlobalConfig);
-        STORE_GLOBAL_SINGLETON(IP, IP);
-        STORE_GLOBAL_SINGLETON(Input, Input);
-        STORE_GLOBAL_SINGLETON(InputMap, InputMap);
-        STORE_GLOBAL_SINGLETON(Marshalls, Marshalls);
-        STORE_GLOBAL_SINGLETON(OS, OS);
-        STORE_GLOBAL_SINGLETON(Engine, Engine);
-        STORE_GLOBAL_SINGLETON(ClassDB, ClassDB);
-        STORE_GLOBAL_SINGLETON(PhysicsServer, PS);
-        STORE_GLOBAL_SINGLETON(Physics2DServer, PS2D);
-        STORE_GLOBAL_SINGLETON(PathRemap, PathRemap);
-        STORE_GLOBAL_SINGLETON(Performance, Performance);
-        STORE_GLOBAL_SINGLETON(Physics2DServer, Physics2DServer);
-        STORE_GLOBAL_SINGLETON(PhysicsServer, PhysicsServer);
-        STORE_GLOBAL_SINGLETON(ResourceLoader, ResourceLoader);
-        STORE_GLOBAL_SINGLETON(ResourceSaver, ResourceSaver);
-        STORE_GLOBAL_SINGLETON(SpatialSoundServer, SS);
-        STORE_GLOBAL_SINGLETON(SpatialSound2DServer, SS2D);
-        STORE_GLOBAL_SINGLETON(SpatialSound2DServer, SpatialSound2DServer);
-        STORE_GLOBAL_SINGLETON(SpatialSoundServer, SpatialSoundServer);
-        STORE_GLOBAL_SINGLETON(TranslationServer, TS);
-        STORE_GLOBAL_SINGLETON(TranslationServer, TranslationServer);
-        STORE_GLOBAL_SINGLETON(VisualServer, VS);
-        STORE_GLOBAL_SINGLETON(VisualServer, VisualServer);
 
         // Bind global constants
         auto int_binder = IntBinder::get_singleton();
@@ -124,34 +275,97 @@ void GodotBindingsModule::build_binders() {
 
 
 const BaseBinder *GodotBindingsModule::get_binder(const StringName &p_type) const {
-    // TODO: optimize this
-    for(auto E=this->_binders.front(); E; E=E->next()) {
-        if (E->get()->get_type_name() == p_type) {
-            return E->get();
-        }
+    const Map<StringName, BaseBinder*>::Element *E = this->_binders_per_name.find(p_type);
+    if (E) {
+        return E->get();
     }
-    return NULL;
+    if (!ClassDB::class_exists(p_type)) {
+        return NULL;
+    }
+    // Not bound yet, parent class is bound by DynamicBinder's constructor
+    auto binder = memnew(DynamicBinder(p_type));
+    this->_store_binder(binder);
+    return binder;
 }
 
 
 const BaseBinder *GodotBindingsModule::get_binder(const qstr type) const {
-    // TODO: optimize this
-    for(auto E=this->_binders.front(); E; E=E->next()) {
-        if (E->get()->get_type_qstr() == type) {
-            return E->get();
-        }
+    const Map<qstr, BaseBinder*>::Element *E = this->_binders_per_qstr.find(type);
+    return E ? E->get() : NULL;
+}
+
+
+#ifdef REAL_T_IS_DOUBLE
+#define REAL_TYPECODE 'd'
+#else
+#define REAL_TYPECODE 'f'
+#endif
+
+
+// `array.array(p_typecode, ...)` holding a copy of `p_size` bytes of items
+static mp_obj_t _new_array(char p_typecode, const void *p_items, size_t p_size) {
+    // The array constructor copies the raw content of a bytearray
+    const mp_obj_t args[2] = {
+        mp_obj_new_str(&p_typecode, 1, false),
+        mp_obj_new_bytearray_by_ref(p_size, const_cast<void *>(p_items)),
+    };
+    return mp_call_function_n_kw(MP_OBJ_FROM_PTR(&mp_type_array), 2, 0, args);
+}
+
+
+template <typename T>
+static PoolVector<T> _buffer_to_pool_vector(const mp_buffer_info_t &p_buffer) {
+    PoolVector<T> array;
+    array.resize(p_buffer.len / sizeof(T));
+    typename PoolVector<T>::Write w = array.write();
+    memcpy(w.ptr(), p_buffer.buf, array.size() * sizeof(T));
+    return array;
+}
+
+
+// Buffers going back to Godot: `bytearray` is a PoolByteArray, `array.array`
+// of ints a PoolIntArray and of floats a PoolRealArray
+static bool _buffer_to_variant(mp_obj_t pyobj, Variant *r_variant) {
+    mp_buffer_info_t buffer;
+    mp_get_buffer_raise(pyobj, &buffer, MP_BUFFER_READ);
+    switch (buffer.typecode) {
+    case BYTEARRAY_TYPECODE:
+        *r_variant = _buffer_to_pool_vector<uint8_t>(buffer);
+        return true;
+    case 'i':
+        *r_variant = _buffer_to_pool_vector<int>(buffer);
+        return true;
+    case REAL_TYPECODE:
+        *r_variant = _buffer_to_pool_vector<real_t>(buffer);
+        return true;
     }
-    return NULL;
+    return false;
 }
 
 
 // This should be called from a micropython context (with nlr_push set)
 Variant GodotBindingsModule::pyobj_to_variant(const mp_obj_t pyobj) const {
     mp_obj_type_t *pyobj_type = mp_obj_get_type(pyobj);
+    // Fast path for RIDs: server APIs (VS, PS...) are called with them
+    // in tight loops, don't go through the binders lookup
+    if (pyobj_type == RIDBinder::get_singleton()->get_mp_type()) {
+        PY_PERF_COUNT_TO_VARIANT(Variant::_RID);
+        return RIDBinder::get_singleton()->pyobj_to_variant(pyobj);
+    }
+    if (pyobj_type == &mp_type_bytearray || pyobj_type == &mp_type_array) {
+        Variant ret;
+        if (_buffer_to_variant(pyobj, &ret)) {
+            PY_PERF_COUNT_TO_VARIANT(ret.get_type());
+            return ret;
+        }
+    }
     auto binder = this->get_binder(pyobj_type->name);
     if (binder != NULL) {
-        return binder->pyobj_to_variant(pyobj);
+        Variant ret = binder->pyobj_to_variant(pyobj);
+        PY_PERF_COUNT_TO_VARIANT(ret.get_type());
+        return ret;
     }
+    PY_PERF_COUNT(EXCEPTION);
     // Not handled raise exception in python caller
     nlr_raise(mp_obj_new_exception_msg_varg(&mp_type_TypeError,
         "Can't convert %s to Godot's Variant", mp_obj_get_type_str(pyobj)));
@@ -159,6 +373,7 @@ Variant GodotBindingsModule::pyobj_to_variant(const mp_obj_t pyobj) const {
 
 
 mp_obj_t GodotBindingsModule::variant_to_pyobj(const Variant &p_variant) const {
+    PY_PERF_COUNT_TO_PYOBJ(p_variant.get_type());
     switch (p_variant.get_type()) {
     case Variant::Type::NIL:
         return mp_const_none;
@@ -177,18 +392,18 @@ mp_obj_t GodotBindingsModule::variant_to_pyobj(const Variant &p_variant) const {
     case Variant::Type::VECTOR2:
         return Vector2Binder::get_singleton()->variant_to_pyobj(p_variant);
     case Variant::Type::RECT2:
-        break;
+        return Rect2Binder::get_singleton()->variant_to_pyobj(p_variant);
     case Variant::Type::VECTOR3:
         return Vector3Binder::get_singleton()->variant_to_pyobj(p_variant);
         break;
     case Variant::Type::TRANSFORM2D:
         break;
     case Variant::Type::PLANE:
-        break;
+        return PlaneBinder::get_singleton()->variant_to_pyobj(p_variant);
     case Variant::Type::QUAT:
         break;
     case Variant::Type::RECT3:
-        break;
+        return Rect3Binder::get_singleton()->variant_to_pyobj(p_variant);
     case Variant::Type::BASIS:
         break;
     case Variant::Type::TRANSFORM:
@@ -196,13 +411,13 @@ mp_obj_t GodotBindingsModule::variant_to_pyobj(const Variant &p_variant) const {
 
     // misc types
     case Variant::Type::COLOR:
-        break;
+        return ColorBinder::get_singleton()->variant_to_pyobj(p_variant);
     case Variant::Type::IMAGE:
         break;
     case Variant::Type::NODE_PATH:
-        break;
+        return NodePathBinder::get_singleton()->variant_to_pyobj(p_variant);
     case Variant::Type::_RID:
-        break;
+        return RIDBinder::get_singleton()->variant_to_pyobj(p_variant);
     case Variant::Type::OBJECT:
     {
         Object *obj = p_variant;
@@ -218,19 +433,45 @@ mp_obj_t GodotBindingsModule::variant_to_pyobj(const Variant &p_variant) const {
     case Variant::Type::INPUT_EVENT:
         break;
     case Variant::Type::DICTIONARY:
-        break;
+    {
+        // Python gets a copy, modifying it doesn't change the Godot dictionary
+        const Dictionary dict = p_variant;
+        List<Variant> keys;
+        dict.get_key_list(&keys);
+        mp_obj_t pydict = mp_obj_new_dict(keys.size());
+        for (const List<Variant>::Element *E = keys.front(); E; E = E->next()) {
+            mp_obj_dict_store(pydict, this->variant_to_pyobj(E->get()), this->variant_to_pyobj(dict[E->get()]));
+        }
+        return pydict;
+    }
     case Variant::Type::ARRAY:
         break;
 
     // arrays
+    // Python gets a copy as a buffer (`bytearray` or `array.array`), usable
+    // from `@micropython.viper` functions (`ptr8`, `ptr32`...) and bulk helpers
     case Variant::Type::POOL_BYTE_ARRAY:
-        break;
+    {
+        const PoolVector<uint8_t> array = p_variant;
+        PoolVector<uint8_t>::Read r = array.read();
+        return mp_obj_new_bytearray(array.size(), const_cast<uint8_t *>(r.ptr()));
+    }
     case Variant::Type::POOL_INT_ARRAY:
-        break;
+    {
+        const PoolVector<int> array = p_variant;
+        PoolVector<int>::Read r = array.read();
+        return _new_array('i', r.ptr(), array.size() * sizeof(int));
+    }
     case Variant::Type::POOL_REAL_ARRAY:
-        break;
+    {
+        const PoolVector<real_t> array = p_variant;
+        PoolVector<real_t>::Read r = array.read();
+        return _new_array(REAL_TYPECODE, r.ptr(), array.size() * sizeof(real_t));
+    }
     case Variant::Type::POOL_STRING_ARRAY:
         break;
+    // A flat float buffer would come back as a PoolRealArray, hence these
+    // ones are not converted until they can round trip
     case Variant::Type::POOL_VECTOR2_ARRAY:
         break;
     case Variant::Type::POOL_VECTOR3_ARRAY:
@@ -4,13 +4,14 @@
 // Godot imports
 #include "core/string_db.h"
 #include "core/list.h"
+#include "core/map.h"
 // Micropython imports
 #include "micropython/micropython.h"
 // Pythonscript imports
 #include "bindings/tools.h"
 
 
-void init_bindings();
+void init_bindings(bool p_lazy);
 
 
 class BaseBinder {
@@ -35,19 +36,33 @@ class GodotBindingsModule : public Singleton<GodotBindingsModule> {
     friend Singleton<GodotBindingsModule>;
 
 private:
-    List<BaseBinder*> _binders;
+    // Classes are bound on first use, binders are only a cache
+    mutable List<BaseBinder*> _binders;
+    mutable Map<StringName, BaseBinder*> _binders_per_name;
+    mutable Map<qstr, BaseBinder*> _binders_per_qstr;
     mp_obj_t _mp_module = mp_const_none;
 
+    void _new_module(bool p_lazy);
+    void _store_binder(BaseBinder *p_binder) const;
+    mp_obj_t _bind_singleton(const char *p_name, const char *p_store_name) const;
+
 protected:
     GodotBindingsModule();
     virtual ~GodotBindingsModule();
 
 public:
-    void build_binders();
+    void build_binders(bool p_lazy);
     _FORCE_INLINE_ mp_obj_t get_mp_module() const { return this->_mp_module; };
+    // Only the binders built so far
+    _FORCE_INLINE_ const List<BaseBinder*> &get_binders() const { return this->_binders; }
+    // Bind the class if needed, must be called from a micropython context
     const BaseBinder *get_binder(const StringName &p_type) const;
     const BaseBinder *get_binder(const qstr type) const;
 
+    // Bind the class, singleton or global constant named `p_attr` into
+    // the module, return MP_OBJ_NULL if there is no such thing
+    mp_obj_t bind_attr(qstr p_attr) const;
+
     mp_obj_t object_to_pyobj(const Object *p_obj) const;
     mp_obj_t variant_to_pyobj(const Variant &p_variant) const;
     Variant pyobj_to_variant(const mp_obj_t pyobj) const;
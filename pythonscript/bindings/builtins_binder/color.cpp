@@ -0,0 +1,195 @@
+#include <stdio.h>
+
+#include "bindings/tools.h"
+#include "bindings/builtins_binder/tools.h"
+#include "bindings/builtins_binder/atomic.h"
+#include "bindings/builtins_binder/color.h"
+
+
+#define BIND_COLOR_COMPONENT(NAME) \
+    BIND_PROPERTY_GETSET(#NAME, \
+        [](mp_obj_t self) -> mp_obj_t { \
+        auto variant = static_cast<ColorBinder::mp_godot_bind_t *>(MP_OBJ_TO_PTR(self)); \
+        return RealBinder::get_singleton()->build_pyobj(variant->godot_color.NAME); \
+    }, \
+        [](mp_obj_t self, mp_obj_t pyval) -> mp_obj_t { \
+        const float val = RETRIEVE_ARG(RealBinder::get_singleton(), pyval, "val"); \
+        auto variant = static_cast<ColorBinder::mp_godot_bind_t *>(MP_OBJ_TO_PTR(self)); \
+        variant->godot_color.NAME = val; \
+        return mp_const_none; \
+    });
+
+
+mp_obj_t ColorBinder::_generate_bind_locals_dict() {
+    // Build micropython type object
+    mp_obj_t locals_dict = mp_obj_new_dict(0);
+
+    // Color blend ( Color over )
+    BIND_METHOD_1("blend", [](mp_obj_t self, mp_obj_t pyover) -> mp_obj_t {
+        Color over = RETRIEVE_ARG(ColorBinder::get_singleton(), pyover, "over");
+        auto variant = static_cast<ColorBinder::mp_godot_bind_t *>(MP_OBJ_TO_PTR(self));
+        Color blend = variant->godot_color.blend(over);
+        return ColorBinder::get_singleton()->build_pyobj(blend);
+    });
+
+    // Color contrasted ( )
+    BIND_METHOD("contrasted", [](mp_obj_t self) -> mp_obj_t {
+        auto variant = static_cast<ColorBinder::mp_godot_bind_t *>(MP_OBJ_TO_PTR(self));
+        Color contrasted = variant->godot_color.contrasted();
+        return ColorBinder::get_singleton()->build_pyobj(contrasted);
+    });
+
+    // float   gray ( )
+    BIND_METHOD("gray", [](mp_obj_t self) -> mp_obj_t {
+        auto variant = static_cast<ColorBinder::mp_godot_bind_t *>(MP_OBJ_TO_PTR(self));
+        float gray = variant->godot_color.gray();
+        return RealBinder::get_singleton()->build_pyobj(gray);
+    });
+
+    // Color inverted ( )
+    BIND_METHOD("inverted", [](mp_obj_t self) -> mp_obj_t {
+        auto variant = static_cast<ColorBinder::mp_godot_bind_t *>(MP_OBJ_TO_PTR(self));
+        Color inverted = variant->godot_color.inverted();
+        return ColorBinder::get_singleton()->build_pyobj(inverted);
+    });
+
+    // Color linear_interpolate ( Color b, float t )
+    BIND_METHOD_2("linear_interpolate", [](mp_obj_t self, mp_obj_t pyb, mp_obj_t pyt) -> mp_obj_t {
+        Color b = RETRIEVE_ARG(ColorBinder::get_singleton(), pyb, "b");
+        float t = RETRIEVE_ARG(RealBinder::get_singleton(), pyt, "t");
+        auto variant = static_cast<ColorBinder::mp_godot_bind_t *>(MP_OBJ_TO_PTR(self));
+        Color linear_interpolate = variant->godot_color.linear_interpolate(b, t);
+        return ColorBinder::get_singleton()->build_pyobj(linear_interpolate);
+    });
+
+    // int     to_32 ( )
+    BIND_METHOD("to_32", [](mp_obj_t self) -> mp_obj_t {
+        auto variant = static_cast<ColorBinder::mp_godot_bind_t *>(MP_OBJ_TO_PTR(self));
+        return mp_obj_new_int_from_uint(variant->godot_color.to_32());
+    });
+
+    // int     to_ARGB32 ( )
+    BIND_METHOD("to_ARGB32", [](mp_obj_t self) -> mp_obj_t {
+        auto variant = static_cast<ColorBinder::mp_godot_bind_t *>(MP_OBJ_TO_PTR(self));
+        return mp_obj_new_int_from_uint(variant->godot_color.to_ARGB32());
+    });
+
+    // String  to_html ( bool with_alpha=True )
+    BIND_METHOD_VAR("to_html", [](size_t n, const mp_obj_t *args) -> mp_obj_t {
+        bool with_alpha = true;
+        if (n == 2) {
+            with_alpha = RETRIEVE_ARG(BoolBinder::get_singleton(), args[1], "with_alpha");
+        }
+        auto variant = static_cast<ColorBinder::mp_godot_bind_t *>(MP_OBJ_TO_PTR(args[0]));
+        return StringBinder::get_singleton()->variant_to_pyobj(variant->godot_color.to_html(with_alpha));
+    }, 1, 2);
+
+    BIND_COLOR_COMPONENT(r);
+    BIND_COLOR_COMPONENT(g);
+    BIND_COLOR_COMPONENT(b);
+    BIND_COLOR_COMPONENT(a);
+    BIND_PROPERTY_GET("h", [](mp_obj_t self) -> mp_obj_t {
+        auto variant = static_cast<ColorBinder::mp_godot_bind_t *>(MP_OBJ_TO_PTR(self));
+        return RealBinder::get_singleton()->build_pyobj(variant->godot_color.get_h());
+    });
+    BIND_PROPERTY_GET("s", [](mp_obj_t self) -> mp_obj_t {
+        auto variant = static_cast<ColorBinder::mp_godot_bind_t *>(MP_OBJ_TO_PTR(self));
+        return RealBinder::get_singleton()->build_pyobj(variant->godot_color.get_s());
+    });
+    BIND_PROPERTY_GET("v", [](mp_obj_t self) -> mp_obj_t {
+        auto variant = static_cast<ColorBinder::mp_godot_bind_t *>(MP_OBJ_TO_PTR(self));
+        return RealBinder::get_singleton()->build_pyobj(variant->godot_color.get_v());
+    });
+
+    return locals_dict;
+}
+
+
+static void _print_color(const mp_print_t *print, mp_obj_t o, mp_print_kind_t kind) {
+    auto self = static_cast<ColorBinder::mp_godot_bind_t*>(MP_OBJ_TO_PTR(o));
+    char buff[128];
+    snprintf(buff, sizeof(buff), "<Color(r=%f, g=%f, b=%f, a=%f)>",
+             self->godot_color.r, self->godot_color.g, self->godot_color.b, self->godot_color.a);
+    mp_printf(print, buff);
+}
+
+
+static mp_obj_t _make_new_color(const mp_obj_type_t *type, size_t n_args, size_t n_kw, const mp_obj_t *all_args) {
+    Color color;
+
+    // Color(), Color("#rrggbb"), Color(r, g, b) or Color(r, g, b, a)
+    mp_arg_check_num(n_args, 0, 0, 4, false);
+    if (n_args == 1) {
+        String html = RETRIEVE_ARG(StringBinder::get_singleton(), all_args[0], "html");
+        if (!Color::html_is_valid(html)) {
+            mp_raise_ValueError("Invalid html color code");
+        }
+        color = Color::html(html);
+    } else if (n_args >= 3) {
+        float r = RETRIEVE_ARG(RealBinder::get_singleton(), all_args[0], "r");
+        float g = RETRIEVE_ARG(RealBinder::get_singleton(), all_args[1], "g");
+        float b = RETRIEVE_ARG(RealBinder::get_singleton(), all_args[2], "b");
+        float a = 1.0;
+        if (n_args == 4) {
+            a = RETRIEVE_ARG(RealBinder::get_singleton(), all_args[3], "a");
+        }
+        color = Color(r, g, b, a);
+    } else if (n_args != 0) {
+        mp_raise_TypeError("Color takes either 0, 1 (html), 3 (r, g, b) or 4 (r, g, b, a) arguments");
+    }
+
+    auto obj = m_new_obj_with_finaliser(ColorBinder::mp_godot_bind_t);
+    obj->base.type = type;
+    obj->godot_color = color;
+    return MP_OBJ_FROM_PTR(obj);
+}
+
+
+static mp_obj_t _binary_op_color(mp_uint_t op, mp_obj_t lhs_in, mp_obj_t rhs_in) {
+    auto self = static_cast<ColorBinder::mp_godot_bind_t*>(MP_OBJ_TO_PTR(lhs_in));
+    if (op == MP_BINARY_OP_EQUAL && mp_obj_get_type(rhs_in) == ColorBinder::get_singleton()->get_mp_type()) {
+        auto other = static_cast<ColorBinder::mp_godot_bind_t*>(MP_OBJ_TO_PTR(rhs_in));
+        return mp_obj_new_bool(self->godot_color == other->godot_color);
+    }
+    // op not supported
+    return MP_OBJ_NULL;
+}
+
+
+ColorBinder::ColorBinder() {
+    const char *name = "Color";
+    this->_type_name= StringName(name);
+    auto locals_dict = ColorBinder::_generate_bind_locals_dict();
+    this->_mp_type = {
+        { &mp_type_type },                        // base
+        qstr_from_str(name),                      // name
+        _print_color,                             // print
+        _make_new_color,                          // make_new
+        0,                                        // call
+        0,                                        // unary_op
+        _binary_op_color,                         // binary_op
+        attr_with_locals_and_properties,          // attr
+        0,                                        // subscr
+        0,                                        // getiter
+        0,                                        // iternext
+        {0},                                      // buffer_p
+        0,                                        // protocol
+        0,                                        // bases_tuple
+        static_cast<mp_obj_dict_t *>(MP_OBJ_TO_PTR(locals_dict))    // locals_dict
+    };
+    this->_p_mp_type = &this->_mp_type;
+}
+
+
+mp_obj_t ColorBinder::build_pyobj(const Color &p_color) const {
+    auto pyobj = m_new_obj_with_finaliser(ColorBinder::mp_godot_bind_t);
+    pyobj->base.type = this->get_mp_type();
+    pyobj->godot_color = p_color;
+    return MP_OBJ_FROM_PTR(pyobj);
+}
+
+
+Variant ColorBinder::pyobj_to_variant(mp_obj_t pyobj) const {
+    auto obj = static_cast<ColorBinder::mp_godot_bind_t *>(MP_OBJ_TO_PTR(pyobj));
+    return Variant(obj->godot_color);
+}
@@ -0,0 +1,35 @@
+#ifndef PYTHONSCRIPT_COLOR_H
+#define PYTHONSCRIPT_COLOR_H
+
+// Godot imports
+#include "core/color.h"
+// Micropython imports
+#include "micropython/micropython.h"
+// Pythonscript imports
+#include "bindings/dynamic_binder.h"
+#include "bindings/tools.h"
+
+
+class ColorBinder : public Singleton<ColorBinder>, public BaseBinder {
+    friend Singleton<ColorBinder>;
+
+protected:
+    ColorBinder();
+    mp_obj_t _generate_bind_locals_dict();
+    mp_obj_type_t _mp_type;
+
+public:
+    typedef struct {
+        mp_obj_base_t base;
+        Color godot_color;
+    } mp_godot_bind_t;
+
+    _FORCE_INLINE_ mp_obj_t build_pyobj() const { auto c = Color(); return this->build_pyobj(c); }
+    mp_obj_t build_pyobj(const Color &p_color) const;
+    Variant pyobj_to_variant(mp_obj_t pyobj) const;
+    _FORCE_INLINE_ mp_obj_t variant_to_pyobj(const Variant &p_variant) const { return this->build_pyobj(p_variant); }
+
+};
+
+
+#endif // PYTHONSCRIPT_COLOR_H
@@ -0,0 +1,176 @@
+#include <stdio.h>
+
+#include "bindings/tools.h"
+#include "bindings/builtins_binder/tools.h"
+#include "bindings/builtins_binder/atomic.h"
+#include "bindings/builtins_binder/node_path.h"
+
+
+mp_obj_t NodePathBinder::_generate_bind_locals_dict() {
+    // Build micropython type object
+    mp_obj_t locals_dict = mp_obj_new_dict(0);
+
+    // NodePath holds a refcounted pointer, so it must be released
+    // explicitly when the python object is collected. `__del__` can also be
+    // called from python, hence the path is reset rather than destroyed: an
+    // empty NodePath owns nothing, stays usable and is released again for free
+    BIND_METHOD("__del__", [](mp_obj_t self) -> mp_obj_t {
+        auto variant = static_cast<NodePathBinder::mp_godot_bind_t *>(MP_OBJ_TO_PTR(self));
+        variant->godot_node_path = NodePath();
+        return mp_const_none;
+    });
+
+    // String  get_name ( int idx )
+    BIND_METHOD_1("get_name", [](mp_obj_t self, mp_obj_t pyidx) -> mp_obj_t {
+        int idx = RETRIEVE_ARG(IntBinder::get_singleton(), pyidx, "idx");
+        auto variant = static_cast<NodePathBinder::mp_godot_bind_t *>(MP_OBJ_TO_PTR(self));
+        if (idx < 0 || idx >= variant->godot_node_path.get_name_count()) {
+            mp_raise_msg(&mp_type_IndexError, "NodePath name index out of range");
+        }
+        return StringBinder::get_singleton()->variant_to_pyobj(String(variant->godot_node_path.get_name(idx)));
+    });
+
+    // int     get_name_count ( )
+    BIND_METHOD("get_name_count", [](mp_obj_t self) -> mp_obj_t {
+        auto variant = static_cast<NodePathBinder::mp_godot_bind_t *>(MP_OBJ_TO_PTR(self));
+        return IntBinder::get_singleton()->build_pyobj(variant->godot_node_path.get_name_count());
+    });
+
+    // String  get_property ( )
+    BIND_METHOD("get_property", [](mp_obj_t self) -> mp_obj_t {
+        auto variant = static_cast<NodePathBinder::mp_godot_bind_t *>(MP_OBJ_TO_PTR(self));
+        return StringBinder::get_singleton()->variant_to_pyobj(String(variant->godot_node_path.get_property()));
+    });
+
+    // String  get_subname ( int idx )
+    BIND_METHOD_1("get_subname", [](mp_obj_t self, mp_obj_t pyidx) -> mp_obj_t {
+        int idx = RETRIEVE_ARG(IntBinder::get_singleton(), pyidx, "idx");
+        auto variant = static_cast<NodePathBinder::mp_godot_bind_t *>(MP_OBJ_TO_PTR(self));
+        if (idx < 0 || idx >= variant->godot_node_path.get_subname_count()) {
+            mp_raise_msg(&mp_type_IndexError, "NodePath subname index out of range");
+        }
+        return StringBinder::get_singleton()->variant_to_pyobj(String(variant->godot_node_path.get_subname(idx)));
+    });
+
+    // int     get_subname_count ( )
+    BIND_METHOD("get_subname_count", [](mp_obj_t self) -> mp_obj_t {
+        auto variant = static_cast<NodePathBinder::mp_godot_bind_t *>(MP_OBJ_TO_PTR(self));
+        return IntBinder::get_singleton()->build_pyobj(variant->godot_node_path.get_subname_count());
+    });
+
+    // bool    is_absolute ( )
+    BIND_METHOD("is_absolute", [](mp_obj_t self) -> mp_obj_t {
+        auto variant = static_cast<NodePathBinder::mp_godot_bind_t *>(MP_OBJ_TO_PTR(self));
+        return BoolBinder::get_singleton()->build_pyobj(variant->godot_node_path.is_absolute());
+    });
+
+    // bool    is_empty ( )
+    BIND_METHOD("is_empty", [](mp_obj_t self) -> mp_obj_t {
+        auto variant = static_cast<NodePathBinder::mp_godot_bind_t *>(MP_OBJ_TO_PTR(self));
+        return BoolBinder::get_singleton()->build_pyobj(variant->godot_node_path.is_empty());
+    });
+
+    return locals_dict;
+}
+
+
+static void _print_node_path(const mp_print_t *print, mp_obj_t o, mp_print_kind_t kind) {
+    auto self = static_cast<NodePathBinder::mp_godot_bind_t*>(MP_OBJ_TO_PTR(o));
+    const String path = self->godot_node_path;
+    if (kind == PRINT_STR) {
+        mp_printf(print, "%s", path.utf8().get_data());
+    } else {
+        mp_printf(print, "<NodePath(%s)>", path.utf8().get_data());
+    }
+}
+
+
+static mp_obj_t _make_new_node_path(const mp_obj_type_t *type, size_t n_args, size_t n_kw, const mp_obj_t *all_args) {
+    // NodePath() or NodePath(str path)
+    mp_arg_check_num(n_args, n_kw, 0, 1, false);
+    if (n_args == 1) {
+        if (!MP_OBJ_IS_STR(all_args[0]) && !MP_OBJ_IS_TYPE(all_args[0], type)) {
+            mp_raise_TypeError("path type must be String or NodePath");
+        }
+        return NodePathBinder::get_singleton()->build_pyobj(
+            NodePathBinder::get_singleton()->pyobj_to_node_path(all_args[0]));
+    }
+    return NodePathBinder::get_singleton()->build_pyobj(NodePath());
+}
+
+
+static mp_obj_t _binary_op_node_path(mp_uint_t op, mp_obj_t lhs_in, mp_obj_t rhs_in) {
+    auto self = static_cast<NodePathBinder::mp_godot_bind_t*>(MP_OBJ_TO_PTR(lhs_in));
+    if (op == MP_BINARY_OP_EQUAL && mp_obj_get_type(rhs_in) == NodePathBinder::get_singleton()->get_mp_type()) {
+        auto other = static_cast<NodePathBinder::mp_godot_bind_t*>(MP_OBJ_TO_PTR(rhs_in));
+        return mp_obj_new_bool(self->godot_node_path == other->godot_node_path);
+    }
+    // op not supported
+    return MP_OBJ_NULL;
+}
+
+
+static mp_obj_t _unary_op_node_path(mp_uint_t op, mp_obj_t o_in) {
+    auto self = static_cast<NodePathBinder::mp_godot_bind_t*>(MP_OBJ_TO_PTR(o_in));
+    switch (op) {
+        case MP_UNARY_OP_BOOL: return mp_obj_new_bool(!self->godot_node_path.is_empty());
+        case MP_UNARY_OP_HASH: return MP_OBJ_NEW_SMALL_INT(self->godot_node_path.hash() & MP_SMALL_INT_POSITIVE_MASK);
+        default: return MP_OBJ_NULL; // op not supported
+    }
+}
+
+
+NodePathBinder::NodePathBinder() {
+    const char *name = "NodePath";
+    this->_type_name= StringName(name);
+    auto locals_dict = NodePathBinder::_generate_bind_locals_dict();
+    this->_mp_type = {
+        { &mp_type_type },                        // base
+        qstr_from_str(name),                      // name
+        _print_node_path,                         // print
+        _make_new_node_path,                      // make_new
+        0,                                        // call
+        _unary_op_node_path,                      // unary_op
+        _binary_op_node_path,                     // binary_op
+        attr_with_locals_and_properties,          // attr
+        0,                                        // subscr
+        0,                                        // getiter
+        0,                                        // iternext
+        {0},                                      // buffer_p
+        0,                                        // protocol
+        0,                                        // bases_tuple
+        static_cast<mp_obj_dict_t *>(MP_OBJ_TO_PTR(locals_dict))    // locals_dict
+    };
+    this->_p_mp_type = &this->_mp_type;
+}
+
+
+mp_obj_t NodePathBinder::build_pyobj(const NodePath &p_node_path) const {
+    auto pyobj = m_new_obj_with_finaliser(NodePathBinder::mp_godot_bind_t);
+    pyobj->base.type = this->get_mp_type();
+    // Memory returned by the GC is not a constructed NodePath
+    memnew_placement(&pyobj->godot_node_path, NodePath(p_node_path));
+    return MP_OBJ_FROM_PTR(pyobj);
+}
+
+
+NodePath NodePathBinder::pyobj_to_node_path(mp_obj_t pyobj) const {
+    if (MP_OBJ_IS_TYPE(pyobj, this->_p_mp_type)) {
+        return static_cast<NodePathBinder::mp_godot_bind_t *>(MP_OBJ_TO_PTR(pyobj))->godot_node_path;
+    }
+    if (MP_OBJ_IS_QSTR(pyobj)) {
+        const qstr key = MP_OBJ_QSTR_VALUE(pyobj);
+        auto E = this->_parsed_cache.find(key);
+        if (!E) {
+            E = this->_parsed_cache.insert(key, NodePath(String(qstr_str(key))));
+        }
+        return E->get();
+    }
+    // Dynamically built string, no way to know if it will be reused
+    return NodePath(String(mp_obj_str_get_str(pyobj)));
+}
+
+
+Variant NodePathBinder::pyobj_to_variant(mp_obj_t pyobj) const {
+    return Variant(this->pyobj_to_node_path(pyobj));
+}
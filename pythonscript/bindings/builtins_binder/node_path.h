@@ -0,0 +1,49 @@
+#ifndef PYTHONSCRIPT_NODE_PATH_H
+#define PYTHONSCRIPT_NODE_PATH_H
+
+// Godot imports
+#include "core/path_db.h"
+#include "core/map.h"
+// Micropython imports
+#include "micropython/micropython.h"
+// Pythonscript imports
+#include "bindings/dynamic_binder.h"
+#include "bindings/tools.h"
+
+
+class NodePathBinder : public Singleton<NodePathBinder>, public BaseBinder {
+    friend Singleton<NodePathBinder>;
+
+private:
+    // Parsed paths for interned python strings (i.e. string literals),
+    // a qstr never changes once created so entries never need to be
+    // invalidated: a different literal simply maps to a different qstr.
+    mutable Map<qstr, NodePath> _parsed_cache;
+
+protected:
+    NodePathBinder();
+    mp_obj_t _generate_bind_locals_dict();
+    mp_obj_type_t _mp_type;
+
+public:
+    typedef struct {
+        mp_obj_base_t base;
+        NodePath godot_node_path;
+    } mp_godot_bind_t;
+
+    // Accept both NodePath objects and python strings
+    _FORCE_INLINE_ bool is_type(mp_obj_t pyobj) {
+        return MP_OBJ_IS_TYPE(pyobj, this->_p_mp_type) || MP_OBJ_IS_STR(pyobj);
+    }
+    _FORCE_INLINE_ mp_obj_t build_pyobj() const { return this->build_pyobj(NodePath()); }
+    mp_obj_t build_pyobj(const NodePath &p_node_path) const;
+    Variant pyobj_to_variant(mp_obj_t pyobj) const;
+    _FORCE_INLINE_ mp_obj_t variant_to_pyobj(const Variant &p_variant) const { return this->build_pyobj(p_variant); }
+
+    // Convert a NodePath object or a python string into a godot NodePath,
+    // parsing only once strings that are interned
+    NodePath pyobj_to_node_path(mp_obj_t pyobj) const;
+};
+
+
+#endif // PYTHONSCRIPT_NODE_PATH_H
@@ -0,0 +1,229 @@
+#include <stdio.h>
+
+#include "bindings/tools.h"
+#include "bindings/builtins_binder/tools.h"
+#include "bindings/builtins_binder/atomic.h"
+#include "bindings/builtins_binder/vector3.h"
+#include "bindings/builtins_binder/plane.h"
+
+
+mp_obj_t PlaneBinder::_generate_bind_locals_dict() {
+    // Build micropython type object
+    mp_obj_t locals_dict = mp_obj_new_dict(0);
+
+    // Vector3 center ( )
+    BIND_METHOD("center", [](mp_obj_t self) -> mp_obj_t {
+        auto variant = static_cast<PlaneBinder::mp_godot_bind_t *>(MP_OBJ_TO_PTR(self));
+        Vector3 center = variant->godot_plane.center();
+        return Vector3Binder::get_singleton()->build_pyobj(center);
+    });
+
+    // float   distance_to ( Vector3 point )
+    BIND_METHOD_1("distance_to", [](mp_obj_t self, mp_obj_t pypoint) -> mp_obj_t {
+        Vector3 point = RETRIEVE_ARG(Vector3Binder::get_singleton(), pypoint, "point");
+        auto variant = static_cast<PlaneBinder::mp_godot_bind_t *>(MP_OBJ_TO_PTR(self));
+        float distance_to = variant->godot_plane.distance_to(point);
+        return RealBinder::get_singleton()->build_pyobj(distance_to);
+    });
+
+    // Vector3 get_any_point ( )
+    BIND_METHOD("get_any_point", [](mp_obj_t self) -> mp_obj_t {
+        auto variant = static_cast<PlaneBinder::mp_godot_bind_t *>(MP_OBJ_TO_PTR(self));
+        Vector3 point = variant->godot_plane.get_any_point();
+        return Vector3Binder::get_singleton()->build_pyobj(point);
+    });
+
+    // bool    has_point ( Vector3 point, float epsilon=0.00001 )
+    BIND_METHOD_VAR("has_point", [](size_t n, const mp_obj_t *args) -> mp_obj_t {
+        Vector3 point = RETRIEVE_ARG(Vector3Binder::get_singleton(), args[1], "point");
+        float epsilon = CMP_EPSILON;
+        if (n == 3) {
+            epsilon = RETRIEVE_ARG(RealBinder::get_singleton(), args[2], "epsilon");
+        }
+        auto variant = static_cast<PlaneBinder::mp_godot_bind_t *>(MP_OBJ_TO_PTR(args[0]));
+        bool has_point = variant->godot_plane.has_point(point, epsilon);
+        return BoolBinder::get_singleton()->build_pyobj(has_point);
+    }, 2, 3);
+
+    // Vector3 intersect_3 ( Plane b, Plane c )
+    BIND_METHOD_2("intersect_3", [](mp_obj_t self, mp_obj_t pyb, mp_obj_t pyc) -> mp_obj_t {
+        Plane b = RETRIEVE_ARG(PlaneBinder::get_singleton(), pyb, "b");
+        Plane c = RETRIEVE_ARG(PlaneBinder::get_singleton(), pyc, "c");
+        auto variant = static_cast<PlaneBinder::mp_godot_bind_t *>(MP_OBJ_TO_PTR(self));
+        Vector3 result;
+        if (!variant->godot_plane.intersect_3(b, c, &result)) {
+            return mp_const_none;
+        }
+        return Vector3Binder::get_singleton()->build_pyobj(result);
+    });
+
+    // Vector3 intersects_ray ( Vector3 from, Vector3 dir )
+    BIND_METHOD_2("intersects_ray", [](mp_obj_t self, mp_obj_t pyfrom, mp_obj_t pydir) -> mp_obj_t {
+        Vector3 from = RETRIEVE_ARG(Vector3Binder::get_singleton(), pyfrom, "from");
+        Vector3 dir = RETRIEVE_ARG(Vector3Binder::get_singleton(), pydir, "dir");
+        auto variant = static_cast<PlaneBinder::mp_godot_bind_t *>(MP_OBJ_TO_PTR(self));
+        Vector3 result;
+        if (!variant->godot_plane.intersects_ray(from, dir, &result)) {
+            return mp_const_none;
+        }
+        return Vector3Binder::get_singleton()->build_pyobj(result);
+    });
+
+    // Vector3 intersects_segment ( Vector3 begin, Vector3 end )
+    BIND_METHOD_2("intersects_segment", [](mp_obj_t self, mp_obj_t pybegin, mp_obj_t pyend) -> mp_obj_t {
+        Vector3 begin = RETRIEVE_ARG(Vector3Binder::get_singleton(), pybegin, "begin");
+        Vector3 end = RETRIEVE_ARG(Vector3Binder::get_singleton(), pyend, "end");
+        auto variant = static_cast<PlaneBinder::mp_godot_bind_t *>(MP_OBJ_TO_PTR(self));
+        Vector3 result;
+        if (!variant->godot_plane.intersects_segment(begin, end, &result)) {
+            return mp_const_none;
+        }
+        return Vector3Binder::get_singleton()->build_pyobj(result);
+    });
+
+    // bool    is_point_over ( Vector3 point )
+    BIND_METHOD_1("is_point_over", [](mp_obj_t self, mp_obj_t pypoint) -> mp_obj_t {
+        Vector3 point = RETRIEVE_ARG(Vector3Binder::get_singleton(), pypoint, "point");
+        auto variant = static_cast<PlaneBinder::mp_godot_bind_t *>(MP_OBJ_TO_PTR(self));
+        bool is_point_over = variant->godot_plane.is_point_over(point);
+        return BoolBinder::get_singleton()->build_pyobj(is_point_over);
+    });
+
+    // Plane normalized ( )
+    BIND_METHOD("normalized", [](mp_obj_t self) -> mp_obj_t {
+        auto variant = static_cast<PlaneBinder::mp_godot_bind_t *>(MP_OBJ_TO_PTR(self));
+        Plane normalized = variant->godot_plane.normalized();
+        return PlaneBinder::get_singleton()->build_pyobj(normalized);
+    });
+
+    // Vector3 project ( Vector3 point )
+    BIND_METHOD_1("project", [](mp_obj_t self, mp_obj_t pypoint) -> mp_obj_t {
+        Vector3 point = RETRIEVE_ARG(Vector3Binder::get_singleton(), pypoint, "point");
+        auto variant = static_cast<PlaneBinder::mp_godot_bind_t *>(MP_OBJ_TO_PTR(self));
+        Vector3 project = variant->godot_plane.project(point);
+        return Vector3Binder::get_singleton()->build_pyobj(project);
+    });
+
+    BIND_PROPERTY_GETSET("normal",
+        [](mp_obj_t self) -> mp_obj_t {
+        auto variant = static_cast<PlaneBinder::mp_godot_bind_t *>(MP_OBJ_TO_PTR(self));
+        return Vector3Binder::get_singleton()->build_pyobj(variant->godot_plane.normal);
+    },
+        [](mp_obj_t self, mp_obj_t pyval) -> mp_obj_t {
+        const Vector3 val = RETRIEVE_ARG(Vector3Binder::get_singleton(), pyval, "val");
+        auto variant = static_cast<PlaneBinder::mp_godot_bind_t *>(MP_OBJ_TO_PTR(self));
+        variant->godot_plane.normal = val;
+        return mp_const_none;
+    });
+    BIND_PROPERTY_GETSET("d",
+        [](mp_obj_t self) -> mp_obj_t {
+        auto variant = static_cast<PlaneBinder::mp_godot_bind_t *>(MP_OBJ_TO_PTR(self));
+        return RealBinder::get_singleton()->build_pyobj(variant->godot_plane.d);
+    },
+        [](mp_obj_t self, mp_obj_t pyval) -> mp_obj_t {
+        const float val = RETRIEVE_ARG(RealBinder::get_singleton(), pyval, "val");
+        auto variant = static_cast<PlaneBinder::mp_godot_bind_t *>(MP_OBJ_TO_PTR(self));
+        variant->godot_plane.d = val;
+        return mp_const_none;
+    });
+
+    return locals_dict;
+}
+
+
+static void _print_plane(const mp_print_t *print, mp_obj_t o, mp_print_kind_t kind) {
+    auto self = static_cast<PlaneBinder::mp_godot_bind_t*>(MP_OBJ_TO_PTR(o));
+    char buff[128];
+    snprintf(buff, sizeof(buff), "<Plane(normal=(%f, %f, %f), d=%f)>",
+             self->godot_plane.normal.x, self->godot_plane.normal.y,
+             self->godot_plane.normal.z, self->godot_plane.d);
+    mp_printf(print, buff);
+}
+
+
+static mp_obj_t _make_new_plane(const mp_obj_type_t *type, size_t n_args, size_t n_kw, const mp_obj_t *all_args) {
+    Plane plane;
+
+    // Plane(), Plane(Vector3 normal, float d) or Plane(a, b, c, d)
+    mp_arg_check_num(n_args, 0, 0, 4, false);
+    if (n_args == 2) {
+        Vector3 normal = RETRIEVE_ARG(Vector3Binder::get_singleton(), all_args[0], "normal");
+        float d = RETRIEVE_ARG(RealBinder::get_singleton(), all_args[1], "d");
+        plane = Plane(normal, d);
+    } else if (n_args == 4) {
+        float a = RETRIEVE_ARG(RealBinder::get_singleton(), all_args[0], "a");
+        float b = RETRIEVE_ARG(RealBinder::get_singleton(), all_args[1], "b");
+        float c = RETRIEVE_ARG(RealBinder::get_singleton(), all_args[2], "c");
+        float d = RETRIEVE_ARG(RealBinder::get_singleton(), all_args[3], "d");
+        plane = Plane(a, b, c, d);
+    } else if (n_args != 0) {
+        mp_raise_TypeError("Plane takes either 0, 2 (normal, d) or 4 (a, b, c, d) arguments");
+    }
+
+    auto obj = m_new_obj_with_finaliser(PlaneBinder::mp_godot_bind_t);
+    obj->base.type = type;
+    obj->godot_plane = plane;
+    return MP_OBJ_FROM_PTR(obj);
+}
+
+
+static mp_obj_t _binary_op_plane(mp_uint_t op, mp_obj_t lhs_in, mp_obj_t rhs_in) {
+    auto self = static_cast<PlaneBinder::mp_godot_bind_t*>(MP_OBJ_TO_PTR(lhs_in));
+    if (op == MP_BINARY_OP_EQUAL && mp_obj_get_type(rhs_in) == PlaneBinder::get_singleton()->get_mp_type()) {
+        auto other = static_cast<PlaneBinder::mp_godot_bind_t*>(MP_OBJ_TO_PTR(rhs_in));
+        return mp_obj_new_bool(self->godot_plane == other->godot_plane);
+    }
+    // op not supported
+    return MP_OBJ_NULL;
+}
+
+
+static mp_obj_t _unary_op_plane(mp_uint_t op, mp_obj_t in) {
+    auto self = static_cast<PlaneBinder::mp_godot_bind_t*>(MP_OBJ_TO_PTR(in));
+    switch (op) {
+        case MP_UNARY_OP_POSITIVE:
+            return PlaneBinder::get_singleton()->build_pyobj(self->godot_plane);
+        case MP_UNARY_OP_NEGATIVE:
+            return PlaneBinder::get_singleton()->build_pyobj(-self->godot_plane);
+        default: return MP_OBJ_NULL; // op not supported
+    }
+}
+
+
+PlaneBinder::PlaneBinder() {
+    const char *name = "Plane";
+    this->_type_name= StringName(name);
+    auto locals_dict = PlaneBinder::_generate_bind_locals_dict();
+    this->_mp_type = {
+        { &mp_type_type },                        // base
+        qstr_from_str(name),                      // name
+        _print_plane,                             // print
+        _make_new_plane,                          // make_new
+        0,                                        // call
+        _unary_op_plane,                          // unary_op
+        _binary_op_plane,                         // binary_op
+        attr_with_locals_and_properties,          // attr
+        0,                                        // subscr
+        0,                                        // getiter
+        0,                                        // iternext
+        {0},                                      // buffer_p
+        0,                                        // protocol
+        0,                                        // bases_tuple
+        static_cast<mp_obj_dict_t *>(MP_OBJ_TO_PTR(locals_dict))    // locals_dict
+    };
+    this->_p_mp_type = &this->_mp_type;
+}
+
+
+mp_obj_t PlaneBinder::build_pyobj(const Plane &p_plane) const {
+    auto pyobj = m_new_obj_with_finaliser(PlaneBinder::mp_godot_bind_t);
+    pyobj->base.type = this->get_mp_type();
+    pyobj->godot_plane = p_plane;
+    return MP_OBJ_FROM_PTR(pyobj);
+}
+
+
+Variant PlaneBinder::pyobj_to_variant(mp_obj_t pyobj) const {
+    auto obj = static_cast<PlaneBinder::mp_godot_bind_t *>(MP_OBJ_TO_PTR(pyobj));
+    return Variant(obj->godot_plane);
+}
@@ -0,0 +1,206 @@
+#include <stdio.h>
+
+#include "bindings/tools.h"
+#include "bindings/builtins_binder/tools.h"
+#include "bindings/builtins_binder/atomic.h"
+#include "bindings/builtins_binder/vector2.h"
+#include "bindings/builtins_binder/rect2.h"
+
+
+mp_obj_t Rect2Binder::_generate_bind_locals_dict() {
+    // Build micropython type object
+    mp_obj_t locals_dict = mp_obj_new_dict(0);
+
+    // Rect2 clip ( Rect2 b )
+    BIND_METHOD_1("clip", [](mp_obj_t self, mp_obj_t pyb) -> mp_obj_t {
+        Rect2 b = RETRIEVE_ARG(Rect2Binder::get_singleton(), pyb, "b");
+        auto variant = static_cast<Rect2Binder::mp_godot_bind_t *>(MP_OBJ_TO_PTR(self));
+        Rect2 clip = variant->godot_rect2.clip(b);
+        return Rect2Binder::get_singleton()->build_pyobj(clip);
+    });
+
+    // float   distance_to ( Vector2 point )
+    BIND_METHOD_1("distance_to", [](mp_obj_t self, mp_obj_t pypoint) -> mp_obj_t {
+        Vector2 point = RETRIEVE_ARG(Vector2Binder::get_singleton(), pypoint, "point");
+        auto variant = static_cast<Rect2Binder::mp_godot_bind_t *>(MP_OBJ_TO_PTR(self));
+        float distance_to = variant->godot_rect2.distance_to(point);
+        return RealBinder::get_singleton()->build_pyobj(distance_to);
+    });
+
+    // bool    encloses ( Rect2 b )
+    BIND_METHOD_1("encloses", [](mp_obj_t self, mp_obj_t pyb) -> mp_obj_t {
+        Rect2 b = RETRIEVE_ARG(Rect2Binder::get_singleton(), pyb, "b");
+        auto variant = static_cast<Rect2Binder::mp_godot_bind_t *>(MP_OBJ_TO_PTR(self));
+        bool encloses = variant->godot_rect2.encloses(b);
+        return BoolBinder::get_singleton()->build_pyobj(encloses);
+    });
+
+    // Rect2 expand ( Vector2 to )
+    BIND_METHOD_1("expand", [](mp_obj_t self, mp_obj_t pyto) -> mp_obj_t {
+        Vector2 to = RETRIEVE_ARG(Vector2Binder::get_singleton(), pyto, "to");
+        auto variant = static_cast<Rect2Binder::mp_godot_bind_t *>(MP_OBJ_TO_PTR(self));
+        Rect2 expand = variant->godot_rect2.expand(to);
+        return Rect2Binder::get_singleton()->build_pyobj(expand);
+    });
+
+    // float   get_area ( )
+    BIND_METHOD("get_area", [](mp_obj_t self) -> mp_obj_t {
+        auto variant = static_cast<Rect2Binder::mp_godot_bind_t *>(MP_OBJ_TO_PTR(self));
+        float area = variant->godot_rect2.get_area();
+        return RealBinder::get_singleton()->build_pyobj(area);
+    });
+
+    // Rect2 grow ( float by )
+    BIND_METHOD_1("grow", [](mp_obj_t self, mp_obj_t pyby) -> mp_obj_t {
+        float by = RETRIEVE_ARG(RealBinder::get_singleton(), pyby, "by");
+        auto variant = static_cast<Rect2Binder::mp_godot_bind_t *>(MP_OBJ_TO_PTR(self));
+        Rect2 grow = variant->godot_rect2.grow(by);
+        return Rect2Binder::get_singleton()->build_pyobj(grow);
+    });
+
+    // bool    has_no_area ( )
+    BIND_METHOD("has_no_area", [](mp_obj_t self) -> mp_obj_t {
+        auto variant = static_cast<Rect2Binder::mp_godot_bind_t *>(MP_OBJ_TO_PTR(self));
+        bool has_no_area = variant->godot_rect2.has_no_area();
+        return BoolBinder::get_singleton()->build_pyobj(has_no_area);
+    });
+
+    // bool    has_point ( Vector2 point )
+    BIND_METHOD_1("has_point", [](mp_obj_t self, mp_obj_t pypoint) -> mp_obj_t {
+        Vector2 point = RETRIEVE_ARG(Vector2Binder::get_singleton(), pypoint, "point");
+        auto variant = static_cast<Rect2Binder::mp_godot_bind_t *>(MP_OBJ_TO_PTR(self));
+        bool has_point = variant->godot_rect2.has_point(point);
+        return BoolBinder::get_singleton()->build_pyobj(has_point);
+    });
+
+    // bool    intersects ( Rect2 b )
+    BIND_METHOD_1("intersects", [](mp_obj_t self, mp_obj_t pyb) -> mp_obj_t {
+        Rect2 b = RETRIEVE_ARG(Rect2Binder::get_singleton(), pyb, "b");
+        auto variant = static_cast<Rect2Binder::mp_godot_bind_t *>(MP_OBJ_TO_PTR(self));
+        bool intersects = variant->godot_rect2.intersects(b);
+        return BoolBinder::get_singleton()->build_pyobj(intersects);
+    });
+
+    // Rect2 merge ( Rect2 b )
+    BIND_METHOD_1("merge", [](mp_obj_t self, mp_obj_t pyb) -> mp_obj_t {
+        Rect2 b = RETRIEVE_ARG(Rect2Binder::get_singleton(), pyb, "b");
+        auto variant = static_cast<Rect2Binder::mp_godot_bind_t *>(MP_OBJ_TO_PTR(self));
+        Rect2 merge = variant->godot_rect2.merge(b);
+        return Rect2Binder::get_singleton()->build_pyobj(merge);
+    });
+
+    BIND_PROPERTY_GETSET("pos",
+        [](mp_obj_t self) -> mp_obj_t {
+        auto variant = static_cast<Rect2Binder::mp_godot_bind_t *>(MP_OBJ_TO_PTR(self));
+        return Vector2Binder::get_singleton()->build_pyobj(variant->godot_rect2.pos);
+    },
+        [](mp_obj_t self, mp_obj_t pyval) -> mp_obj_t {
+        const Vector2 val = RETRIEVE_ARG(Vector2Binder::get_singleton(), pyval, "val");
+        auto variant = static_cast<Rect2Binder::mp_godot_bind_t *>(MP_OBJ_TO_PTR(self));
+        variant->godot_rect2.pos = val;
+        return mp_const_none;
+    });
+    BIND_PROPERTY_GETSET("size",
+        [](mp_obj_t self) -> mp_obj_t {
+        auto variant = static_cast<Rect2Binder::mp_godot_bind_t *>(MP_OBJ_TO_PTR(self));
+        return Vector2Binder::get_singleton()->build_pyobj(variant->godot_rect2.size);
+    },
+        [](mp_obj_t self, mp_obj_t pyval) -> mp_obj_t {
+        const Vector2 val = RETRIEVE_ARG(Vector2Binder::get_singleton(), pyval, "val");
+        auto variant = static_cast<Rect2Binder::mp_godot_bind_t *>(MP_OBJ_TO_PTR(self));
+        variant->godot_rect2.size = val;
+        return mp_const_none;
+    });
+    BIND_PROPERTY_GET("end", [](mp_obj_t self) -> mp_obj_t {
+        auto variant = static_cast<Rect2Binder::mp_godot_bind_t *>(MP_OBJ_TO_PTR(self));
+        return Vector2Binder::get_singleton()->build_pyobj(variant->godot_rect2.pos + variant->godot_rect2.size);
+    });
+
+    return locals_dict;
+}
+
+
+static void _print_rect2(const mp_print_t *print, mp_obj_t o, mp_print_kind_t kind) {
+    auto self = static_cast<Rect2Binder::mp_godot_bind_t*>(MP_OBJ_TO_PTR(o));
+    char buff[128];
+    snprintf(buff, sizeof(buff), "<Rect2(x=%f, y=%f, width=%f, height=%f)>",
+             self->godot_rect2.pos.x, self->godot_rect2.pos.y,
+             self->godot_rect2.size.x, self->godot_rect2.size.y);
+    mp_printf(print, buff);
+}
+
+
+static mp_obj_t _make_new_rect2(const mp_obj_type_t *type, size_t n_args, size_t n_kw, const mp_obj_t *all_args) {
+    Rect2 rect2;
+
+    // Rect2(), Rect2(Vector2 pos, Vector2 size) or Rect2(x, y, width, height)
+    mp_arg_check_num(n_args, 0, 0, 4, false);
+    if (n_args == 2) {
+        Vector2 pos = RETRIEVE_ARG(Vector2Binder::get_singleton(), all_args[0], "pos");
+        Vector2 size = RETRIEVE_ARG(Vector2Binder::get_singleton(), all_args[1], "size");
+        rect2 = Rect2(pos, size);
+    } else if (n_args == 4) {
+        float x = RETRIEVE_ARG(RealBinder::get_singleton(), all_args[0], "x");
+        float y = RETRIEVE_ARG(RealBinder::get_singleton(), all_args[1], "y");
+        float width = RETRIEVE_ARG(RealBinder::get_singleton(), all_args[2], "width");
+        float height = RETRIEVE_ARG(RealBinder::get_singleton(), all_args[3], "height");
+        rect2 = Rect2(x, y, width, height);
+    } else if (n_args != 0) {
+        mp_raise_TypeError("Rect2 takes either 0, 2 (pos, size) or 4 (x, y, width, height) arguments");
+    }
+
+    auto obj = m_new_obj_with_finaliser(Rect2Binder::mp_godot_bind_t);
+    obj->base.type = type;
+    obj->godot_rect2 = rect2;
+    return MP_OBJ_FROM_PTR(obj);
+}
+
+
+static mp_obj_t _binary_op_rect2(mp_uint_t op, mp_obj_t lhs_in, mp_obj_t rhs_in) {
+    auto self = static_cast<Rect2Binder::mp_godot_bind_t*>(MP_OBJ_TO_PTR(lhs_in));
+    if (op == MP_BINARY_OP_EQUAL && mp_obj_get_type(rhs_in) == Rect2Binder::get_singleton()->get_mp_type()) {
+        auto other = static_cast<Rect2Binder::mp_godot_bind_t*>(MP_OBJ_TO_PTR(rhs_in));
+        return mp_obj_new_bool(self->godot_rect2 == other->godot_rect2);
+    }
+    // op not supported
+    return MP_OBJ_NULL;
+}
+
+
+Rect2Binder::Rect2Binder() {
+    const char *name = "Rect2";
+    this->_type_name= StringName(name);
+    auto locals_dict = Rect2Binder::_generate_bind_locals_dict();
+    this->_mp_type = {
+        { &mp_type_type },                        // base
+        qstr_from_str(name),                      // name
+        _print_rect2,                             // print
+        _make_new_rect2,                          // make_new
+        0,                                        // call
+        0,                                        // unary_op
+        _binary_op_rect2,                         // binary_op
+        attr_with_locals_and_properties,          // attr
+        0,                                        // subscr
+        0,                                        // getiter
+        0,                                        // iternext
+        {0},                                      // buffer_p
+        0,                                        // protocol
+        0,                                        // bases_tuple
+        static_cast<mp_obj_dict_t *>(MP_OBJ_TO_PTR(locals_dict))    // locals_dict
+    };
+    this->_p_mp_type = &this->_mp_type;
+}
+
+
+mp_obj_t Rect2Binder::build_pyobj(const Rect2 &p_rect2) const {
+    auto pyobj = m_new_obj_with_finaliser(Rect2Binder::mp_godot_bind_t);
+    pyobj->base.type = this->get_mp_type();
+    pyobj->godot_rect2 = p_rect2;
+    return MP_OBJ_FROM_PTR(pyobj);
+}
+
+
+Variant Rect2Binder::pyobj_to_variant(mp_obj_t pyobj) const {
+    auto obj = static_cast<Rect2Binder::mp_godot_bind_t *>(MP_OBJ_TO_PTR(pyobj));
+    return Variant(obj->godot_rect2);
+}
@@ -0,0 +1,35 @@
+#ifndef PYTHONSCRIPT_RECT2_H
+#define PYTHONSCRIPT_RECT2_H
+
+// Godot imports
+#include "core/math/math_2d.h"
+// Micropython imports
+#include "micropython/micropython.h"
+// Pythonscript imports
+#include "bindings/dynamic_binder.h"
+#include "bindings/tools.h"
+
+
+class Rect2Binder : public Singleton<Rect2Binder>, public BaseBinder {
+    friend Singleton<Rect2Binder>;
+
+protected:
+    Rect2Binder();
+    mp_obj_t _generate_bind_locals_dict();
+    mp_obj_type_t _mp_type;
+
+public:
+    typedef struct {
+        mp_obj_base_t base;
+        Rect2 godot_rect2;
+    } mp_godot_bind_t;
+
+    _FORCE_INLINE_ mp_obj_t build_pyobj() const { auto r = Rect2(); return this->build_pyobj(r); }
+    mp_obj_t build_pyobj(const Rect2 &p_rect2) const;
+    Variant pyobj_to_variant(mp_obj_t pyobj) const;
+    _FORCE_INLINE_ mp_obj_t variant_to_pyobj(const Variant &p_variant) const { return this->build_pyobj(p_variant); }
+
+};
+
+
+#endif // PYTHONSCRIPT_RECT2_H
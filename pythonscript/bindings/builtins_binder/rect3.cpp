@@ -0,0 +1,231 @@
+#include <stdio.h>
+
+#include "bindings/tools.h"
+#include "bindings/builtins_binder/tools.h"
+#include "bindings/builtins_binder/atomic.h"
+#include "bindings/builtins_binder/vector3.h"
+#include "bindings/builtins_binder/plane.h"
+#include "bindings/builtins_binder/rect3.h"
+
+
+mp_obj_t Rect3Binder::_generate_bind_locals_dict() {
+    // Build micropython type object
+    mp_obj_t locals_dict = mp_obj_new_dict(0);
+
+    // bool    encloses ( Rect3 with )
+    BIND_METHOD_1("encloses", [](mp_obj_t self, mp_obj_t pywith) -> mp_obj_t {
+        Rect3 with = RETRIEVE_ARG(Rect3Binder::get_singleton(), pywith, "with");
+        auto variant = static_cast<Rect3Binder::mp_godot_bind_t *>(MP_OBJ_TO_PTR(self));
+        bool encloses = variant->godot_rect3.encloses(with);
+        return BoolBinder::get_singleton()->build_pyobj(encloses);
+    });
+
+    // Rect3 expand ( Vector3 to_point )
+    BIND_METHOD_1("expand", [](mp_obj_t self, mp_obj_t pyto_point) -> mp_obj_t {
+        Vector3 to_point = RETRIEVE_ARG(Vector3Binder::get_singleton(), pyto_point, "to_point");
+        auto variant = static_cast<Rect3Binder::mp_godot_bind_t *>(MP_OBJ_TO_PTR(self));
+        Rect3 expand = variant->godot_rect3.expand(to_point);
+        return Rect3Binder::get_singleton()->build_pyobj(expand);
+    });
+
+    // float   get_area ( )
+    BIND_METHOD("get_area", [](mp_obj_t self) -> mp_obj_t {
+        auto variant = static_cast<Rect3Binder::mp_godot_bind_t *>(MP_OBJ_TO_PTR(self));
+        float area = variant->godot_rect3.get_area();
+        return RealBinder::get_singleton()->build_pyobj(area);
+    });
+
+    // Vector3 get_longest_axis ( )
+    BIND_METHOD("get_longest_axis", [](mp_obj_t self) -> mp_obj_t {
+        auto variant = static_cast<Rect3Binder::mp_godot_bind_t *>(MP_OBJ_TO_PTR(self));
+        Vector3 axis = variant->godot_rect3.get_longest_axis();
+        return Vector3Binder::get_singleton()->build_pyobj(axis);
+    });
+
+    // Vector3 get_shortest_axis ( )
+    BIND_METHOD("get_shortest_axis", [](mp_obj_t self) -> mp_obj_t {
+        auto variant = static_cast<Rect3Binder::mp_godot_bind_t *>(MP_OBJ_TO_PTR(self));
+        Vector3 axis = variant->godot_rect3.get_shortest_axis();
+        return Vector3Binder::get_singleton()->build_pyobj(axis);
+    });
+
+    // Rect3 grow ( float by )
+    BIND_METHOD_1("grow", [](mp_obj_t self, mp_obj_t pyby) -> mp_obj_t {
+        float by = RETRIEVE_ARG(RealBinder::get_singleton(), pyby, "by");
+        auto variant = static_cast<Rect3Binder::mp_godot_bind_t *>(MP_OBJ_TO_PTR(self));
+        Rect3 grow = variant->godot_rect3.grow(by);
+        return Rect3Binder::get_singleton()->build_pyobj(grow);
+    });
+
+    // bool    has_no_area ( )
+    BIND_METHOD("has_no_area", [](mp_obj_t self) -> mp_obj_t {
+        auto variant = static_cast<Rect3Binder::mp_godot_bind_t *>(MP_OBJ_TO_PTR(self));
+        bool has_no_area = variant->godot_rect3.has_no_area();
+        return BoolBinder::get_singleton()->build_pyobj(has_no_area);
+    });
+
+    // bool    has_no_surface ( )
+    BIND_METHOD("has_no_surface", [](mp_obj_t self) -> mp_obj_t {
+        auto variant = static_cast<Rect3Binder::mp_godot_bind_t *>(MP_OBJ_TO_PTR(self));
+        bool has_no_surface = variant->godot_rect3.has_no_surface();
+        return BoolBinder::get_singleton()->build_pyobj(has_no_surface);
+    });
+
+    // bool    has_point ( Vector3 point )
+    BIND_METHOD_1("has_point", [](mp_obj_t self, mp_obj_t pypoint) -> mp_obj_t {
+        Vector3 point = RETRIEVE_ARG(Vector3Binder::get_singleton(), pypoint, "point");
+        auto variant = static_cast<Rect3Binder::mp_godot_bind_t *>(MP_OBJ_TO_PTR(self));
+        bool has_point = variant->godot_rect3.has_point(point);
+        return BoolBinder::get_singleton()->build_pyobj(has_point);
+    });
+
+    // Rect3 intersection ( Rect3 with )
+    BIND_METHOD_1("intersection", [](mp_obj_t self, mp_obj_t pywith) -> mp_obj_t {
+        Rect3 with = RETRIEVE_ARG(Rect3Binder::get_singleton(), pywith, "with");
+        auto variant = static_cast<Rect3Binder::mp_godot_bind_t *>(MP_OBJ_TO_PTR(self));
+        Rect3 intersection = variant->godot_rect3.intersection(with);
+        return Rect3Binder::get_singleton()->build_pyobj(intersection);
+    });
+
+    // bool    intersects ( Rect3 with )
+    BIND_METHOD_1("intersects", [](mp_obj_t self, mp_obj_t pywith) -> mp_obj_t {
+        Rect3 with = RETRIEVE_ARG(Rect3Binder::get_singleton(), pywith, "with");
+        auto variant = static_cast<Rect3Binder::mp_godot_bind_t *>(MP_OBJ_TO_PTR(self));
+        bool intersects = variant->godot_rect3.intersects(with);
+        return BoolBinder::get_singleton()->build_pyobj(intersects);
+    });
+
+    // bool    intersects_plane ( Plane plane )
+    BIND_METHOD_1("intersects_plane", [](mp_obj_t self, mp_obj_t pyplane) -> mp_obj_t {
+        Plane plane = RETRIEVE_ARG(PlaneBinder::get_singleton(), pyplane, "plane");
+        auto variant = static_cast<Rect3Binder::mp_godot_bind_t *>(MP_OBJ_TO_PTR(self));
+        bool intersects_plane = variant->godot_rect3.intersects_plane(plane);
+        return BoolBinder::get_singleton()->build_pyobj(intersects_plane);
+    });
+
+    // bool    intersects_segment ( Vector3 from, Vector3 to )
+    BIND_METHOD_2("intersects_segment", [](mp_obj_t self, mp_obj_t pyfrom, mp_obj_t pyto) -> mp_obj_t {
+        Vector3 from = RETRIEVE_ARG(Vector3Binder::get_singleton(), pyfrom, "from");
+        Vector3 to = RETRIEVE_ARG(Vector3Binder::get_singleton(), pyto, "to");
+        auto variant = static_cast<Rect3Binder::mp_godot_bind_t *>(MP_OBJ_TO_PTR(self));
+        bool intersects_segment = variant->godot_rect3.intersects_segment(from, to);
+        return BoolBinder::get_singleton()->build_pyobj(intersects_segment);
+    });
+
+    // Rect3 merge ( Rect3 with )
+    BIND_METHOD_1("merge", [](mp_obj_t self, mp_obj_t pywith) -> mp_obj_t {
+        Rect3 with = RETRIEVE_ARG(Rect3Binder::get_singleton(), pywith, "with");
+        auto variant = static_cast<Rect3Binder::mp_godot_bind_t *>(MP_OBJ_TO_PTR(self));
+        Rect3 merge = variant->godot_rect3.merge(with);
+        return Rect3Binder::get_singleton()->build_pyobj(merge);
+    });
+
+    BIND_PROPERTY_GETSET("pos",
+        [](mp_obj_t self) -> mp_obj_t {
+        auto variant = static_cast<Rect3Binder::mp_godot_bind_t *>(MP_OBJ_TO_PTR(self));
+        return Vector3Binder::get_singleton()->build_pyobj(variant->godot_rect3.pos);
+    },
+        [](mp_obj_t self, mp_obj_t pyval) -> mp_obj_t {
+        const Vector3 val = RETRIEVE_ARG(Vector3Binder::get_singleton(), pyval, "val");
+        auto variant = static_cast<Rect3Binder::mp_godot_bind_t *>(MP_OBJ_TO_PTR(self));
+        variant->godot_rect3.pos = val;
+        return mp_const_none;
+    });
+    BIND_PROPERTY_GETSET("size",
+        [](mp_obj_t self) -> mp_obj_t {
+        auto variant = static_cast<Rect3Binder::mp_godot_bind_t *>(MP_OBJ_TO_PTR(self));
+        return Vector3Binder::get_singleton()->build_pyobj(variant->godot_rect3.size);
+    },
+        [](mp_obj_t self, mp_obj_t pyval) -> mp_obj_t {
+        const Vector3 val = RETRIEVE_ARG(Vector3Binder::get_singleton(), pyval, "val");
+        auto variant = static_cast<Rect3Binder::mp_godot_bind_t *>(MP_OBJ_TO_PTR(self));
+        variant->godot_rect3.size = val;
+        return mp_const_none;
+    });
+    BIND_PROPERTY_GET("end", [](mp_obj_t self) -> mp_obj_t {
+        auto variant = static_cast<Rect3Binder::mp_godot_bind_t *>(MP_OBJ_TO_PTR(self));
+        return Vector3Binder::get_singleton()->build_pyobj(variant->godot_rect3.pos + variant->godot_rect3.size);
+    });
+
+    return locals_dict;
+}
+
+
+static void _print_rect3(const mp_print_t *print, mp_obj_t o, mp_print_kind_t kind) {
+    auto self = static_cast<Rect3Binder::mp_godot_bind_t*>(MP_OBJ_TO_PTR(o));
+    char buff[160];
+    snprintf(buff, sizeof(buff), "<Rect3(pos=(%f, %f, %f), size=(%f, %f, %f))>",
+             self->godot_rect3.pos.x, self->godot_rect3.pos.y, self->godot_rect3.pos.z,
+             self->godot_rect3.size.x, self->godot_rect3.size.y, self->godot_rect3.size.z);
+    mp_printf(print, buff);
+}
+
+
+static mp_obj_t _make_new_rect3(const mp_obj_type_t *type, size_t n_args, size_t n_kw, const mp_obj_t *all_args) {
+    Rect3 rect3;
+
+    // Rect3() or Rect3(Vector3 pos, Vector3 size)
+    mp_arg_check_num(n_args, 0, 0, 2, false);
+    if (n_args == 2) {
+        Vector3 pos = RETRIEVE_ARG(Vector3Binder::get_singleton(), all_args[0], "pos");
+        Vector3 size = RETRIEVE_ARG(Vector3Binder::get_singleton(), all_args[1], "size");
+        rect3 = Rect3(pos, size);
+    } else if (n_args != 0) {
+        mp_raise_TypeError("Rect3 takes either 0 or 2 (pos, size) arguments");
+    }
+
+    auto obj = m_new_obj_with_finaliser(Rect3Binder::mp_godot_bind_t);
+    obj->base.type = type;
+    obj->godot_rect3 = rect3;
+    return MP_OBJ_FROM_PTR(obj);
+}
+
+
+static mp_obj_t _binary_op_rect3(mp_uint_t op, mp_obj_t lhs_in, mp_obj_t rhs_in) {
+    auto self = static_cast<Rect3Binder::mp_godot_bind_t*>(MP_OBJ_TO_PTR(lhs_in));
+    if (op == MP_BINARY_OP_EQUAL && mp_obj_get_type(rhs_in) == Rect3Binder::get_singleton()->get_mp_type()) {
+        auto other = static_cast<Rect3Binder::mp_godot_bind_t*>(MP_OBJ_TO_PTR(rhs_in));
+        return mp_obj_new_bool(self->godot_rect3 == other->godot_rect3);
+    }
+    // op not supported
+    return MP_OBJ_NULL;
+}
+
+
+Rect3Binder::Rect3Binder() {
+    const char *name = "Rect3";
+    this->_type_name= StringName(name);
+    auto locals_dict = Rect3Binder::_generate_bind_locals_dict();
+    this->_mp_type = {
+        { &mp_type_type },                        // base
+        qstr_from_str(name),                      // name
+        _print_rect3,                             // print
+        _make_new_rect3,                          // make_new
+        0,                                        // call
+        0,                                        // unary_op
+        _binary_op_rect3,                         // binary_op
+        attr_with_locals_and_properties,          // attr
+        0,                                        // subscr
+        0,                                        // getiter
+        0,                                        // iternext
+        {0},                                      // buffer_p
+        0,                                        // protocol
+        0,                                        // bases_tuple
+        static_cast<mp_obj_dict_t *>(MP_OBJ_TO_PTR(locals_dict))    // locals_dict
+    };
+    this->_p_mp_type = &this->_mp_type;
+}
+
+
+mp_obj_t Rect3Binder::build_pyobj(const Rect3 &p_rect3) const {
+    auto pyobj = m_new_obj_with_finaliser(Rect3Binder::mp_godot_bind_t);
+    pyobj->base.type = this->get_mp_type();
+    pyobj->godot_rect3 = p_rect3;
+    return MP_OBJ_FROM_PTR(pyobj);
+}
+
+
+Variant Rect3Binder::pyobj_to_variant(mp_obj_t pyobj) const {
+    auto obj = static_cast<Rect3Binder::mp_godot_bind_t *>(MP_OBJ_TO_PTR(pyobj));
+    return Variant(obj->godot_rect3);
+}
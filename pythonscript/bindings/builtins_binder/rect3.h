@@ -0,0 +1,35 @@
+#ifndef PYTHONSCRIPT_RECT3_H
+#define PYTHONSCRIPT_RECT3_H
+
+// Godot imports
+#include "core/math/rect3.h"
+// Micropython imports
+#include "micropython/micropython.h"
+// Pythonscript imports
+#include "bindings/dynamic_binder.h"
+#include "bindings/tools.h"
+
+
+class Rect3Binder : public Singleton<Rect3Binder>, public BaseBinder {
+    friend Singleton<Rect3Binder>;
+
+protected:
+    Rect3Binder();
+    mp_obj_t _generate_bind_locals_dict();
+    mp_obj_type_t _mp_type;
+
+public:
+    typedef struct {
+        mp_obj_base_t base;
+        Rect3 godot_rect3;
+    } mp_godot_bind_t;
+
+    _FORCE_INLINE_ mp_obj_t build_pyobj() const { auto r = Rect3(); return this->build_pyobj(r); }
+    mp_obj_t build_pyobj(const Rect3 &p_rect3) const;
+    Variant pyobj_to_variant(mp_obj_t pyobj) const;
+    _FORCE_INLINE_ mp_obj_t variant_to_pyobj(const Variant &p_variant) const { return this->build_pyobj(p_variant); }
+
+};
+
+
+#endif // PYTHONSCRIPT_RECT3_H
@@ -0,0 +1,101 @@
+#include <stdio.h>
+
+#include "bindings/tools.h"
+#include "bindings/builtins_binder/tools.h"
+#include "bindings/builtins_binder/atomic.h"
+#include "bindings/builtins_binder/rid.h"
+
+
+mp_obj_t RIDBinder::_generate_bind_locals_dict() {
+    // Build micropython type object
+    mp_obj_t locals_dict = mp_obj_new_dict(0);
+
+    // int     get_id ( )
+    BIND_METHOD("get_id", [](mp_obj_t self) -> mp_obj_t {
+        auto variant = static_cast<RIDBinder::mp_godot_bind_t *>(MP_OBJ_TO_PTR(self));
+        return mp_obj_new_int_from_uint(variant->godot_rid.get_id());
+    });
+
+    // bool    is_valid ( )
+    BIND_METHOD("is_valid", [](mp_obj_t self) -> mp_obj_t {
+        auto variant = static_cast<RIDBinder::mp_godot_bind_t *>(MP_OBJ_TO_PTR(self));
+        return BoolBinder::get_singleton()->build_pyobj(variant->godot_rid.is_valid());
+    });
+
+    return locals_dict;
+}
+
+
+static void _print_rid(const mp_print_t *print, mp_obj_t o, mp_print_kind_t kind) {
+    auto self = static_cast<RIDBinder::mp_godot_bind_t*>(MP_OBJ_TO_PTR(o));
+    mp_printf(print, "<RID(id=%u)>", self->godot_rid.get_id());
+}
+
+
+static mp_obj_t _make_new_rid(const mp_obj_type_t *type, size_t n_args, size_t n_kw, const mp_obj_t *all_args) {
+    // RIDs can only be created by the servers, python can only build an invalid one
+    mp_arg_check_num(n_args, n_kw, 0, 0, false);
+    return RIDBinder::get_singleton()->build_pyobj(RID());
+}
+
+
+static mp_obj_t _unary_op_rid(mp_uint_t op, mp_obj_t o_in) {
+    auto self = static_cast<RIDBinder::mp_godot_bind_t*>(MP_OBJ_TO_PTR(o_in));
+    switch (op) {
+        case MP_UNARY_OP_BOOL: return mp_obj_new_bool(self->godot_rid.is_valid());
+        case MP_UNARY_OP_HASH: return MP_OBJ_NEW_SMALL_INT(self->godot_rid.get_id() & MP_SMALL_INT_POSITIVE_MASK);
+        default: return MP_OBJ_NULL; // op not supported
+    }
+}
+
+
+static mp_obj_t _binary_op_rid(mp_uint_t op, mp_obj_t lhs_in, mp_obj_t rhs_in) {
+    if (mp_obj_get_type(rhs_in) != RIDBinder::get_singleton()->get_mp_type()) {
+        // op not supported
+        return MP_OBJ_NULL;
+    }
+    const RID &self = static_cast<RIDBinder::mp_godot_bind_t*>(MP_OBJ_TO_PTR(lhs_in))->godot_rid;
+    const RID &other = static_cast<RIDBinder::mp_godot_bind_t*>(MP_OBJ_TO_PTR(rhs_in))->godot_rid;
+    switch (op) {
+        case MP_BINARY_OP_EQUAL: return mp_obj_new_bool(self == other);
+        case MP_BINARY_OP_LESS: return mp_obj_new_bool(self < other);
+        case MP_BINARY_OP_MORE: return mp_obj_new_bool(self > other);
+        case MP_BINARY_OP_LESS_EQUAL: return mp_obj_new_bool(self <= other);
+        case MP_BINARY_OP_MORE_EQUAL: return mp_obj_new_bool(self >= other);
+        default: return MP_OBJ_NULL; // op not supported
+    }
+}
+
+
+RIDBinder::RIDBinder() {
+    const char *name = "RID";
+    this->_type_name= StringName(name);
+    auto locals_dict = RIDBinder::_generate_bind_locals_dict();
+    this->_mp_type = {
+        { &mp_type_type },                        // base
+        qstr_from_str(name),                      // name
+        _print_rid,                               // print
+        _make_new_rid,                            // make_new
+        0,                                        // call
+        _unary_op_rid,                            // unary_op
+        _binary_op_rid,                           // binary_op
+        attr_with_locals_and_properties,          // attr
+        0,                                        // subscr
+        0,                                        // getiter
+        0,                                        // iternext
+        {0},                                      // buffer_p
+        0,                                        // protocol
+        0,                                        // bases_tuple
+        static_cast<mp_obj_dict_t *>(MP_OBJ_TO_PTR(locals_dict))    // locals_dict
+    };
+    this->_p_mp_type = &this->_mp_type;
+}
+
+
+mp_obj_t RIDBinder::build_pyobj(const RID &p_rid) const {
+    // RID is a single pointer, no need for a finaliser
+    auto pyobj = m_new_obj(RIDBinder::mp_godot_bind_t);
+    pyobj->base.type = this->get_mp_type();
+    pyobj->godot_rid = p_rid;
+    return MP_OBJ_FROM_PTR(pyobj);
+}
@@ -0,0 +1,37 @@
+#ifndef PYTHONSCRIPT_RID_H
+#define PYTHONSCRIPT_RID_H
+
+// Godot imports
+#include "core/rid.h"
+// Micropython imports
+#include "micropython/micropython.h"
+// Pythonscript imports
+#include "bindings/dynamic_binder.h"
+#include "bindings/tools.h"
+
+
+class RIDBinder : public Singleton<RIDBinder>, public BaseBinder {
+    friend Singleton<RIDBinder>;
+
+protected:
+    RIDBinder();
+    mp_obj_t _generate_bind_locals_dict();
+    mp_obj_type_t _mp_type;
+
+public:
+    typedef struct {
+        mp_obj_base_t base;
+        RID godot_rid;
+    } mp_godot_bind_t;
+
+    _FORCE_INLINE_ mp_obj_t build_pyobj() const { return this->build_pyobj(RID()); }
+    mp_obj_t build_pyobj(const RID &p_rid) const;
+    _FORCE_INLINE_ Variant pyobj_to_variant(mp_obj_t pyobj) const {
+        return Variant(static_cast<mp_godot_bind_t *>(MP_OBJ_TO_PTR(pyobj))->godot_rid);
+    }
+    _FORCE_INLINE_ mp_obj_t variant_to_pyobj(const Variant &p_variant) const { return this->build_pyobj(p_variant); }
+
+};
+
+
+#endif // PYTHONSCRIPT_RID_H
@@ -12,7 +12,7 @@
     auto o = m_new_obj(mp_obj_fun_builtin_fixed_t); \
     o->base.type = &mp_type_fun_builtin_1; \
     o->fun._1 = GETTER; \
-    mp_obj_t property = mp_call_function_1(MP_OBJ_FROM_PTR(&mp_type_property), o); \
+    mp_obj_t property = mp_call_function_1(MP_OBJ_FROM_PTR(&mp_type_property), MP_OBJ_FROM_PTR(o)); \
     auto n = MP_OBJ_NEW_QSTR(qstr_from_str(NAME)); \
     mp_obj_dict_store(locals_dict, n, property); \
 }
@@ -25,7 +25,7 @@
     auto s = m_new_obj(mp_obj_fun_builtin_fixed_t); \
     s->base.type = &mp_type_fun_builtin_2; \
     s->fun._2 = SETTER; \
-    mp_obj_t property = mp_call_function_2(MP_OBJ_FROM_PTR(&mp_type_property), g, s); \
+    mp_obj_t property = mp_call_function_2(MP_OBJ_FROM_PTR(&mp_type_property), MP_OBJ_FROM_PTR(g), MP_OBJ_FROM_PTR(s)); \
     auto n = MP_OBJ_NEW_QSTR(qstr_from_str(NAME)); \
     mp_obj_dict_store(locals_dict, n, property); \
 }
@@ -36,7 +36,7 @@
     o->base.type = &mp_type_fun_builtin_1; \
     o->fun._1 = CB; \
     auto n = MP_OBJ_NEW_QSTR(qstr_from_str(NAME)); \
-    mp_obj_dict_store(locals_dict, n, o); \
+    mp_obj_dict_store(locals_dict, n, MP_OBJ_FROM_PTR(o)); \
 }
 
 
@@ -45,7 +45,7 @@
     o->base.type = &mp_type_fun_builtin_2; \
     o->fun._2 = CB; \
     auto n = MP_OBJ_NEW_QSTR(qstr_from_str(NAME)); \
-    mp_obj_dict_store(locals_dict, n, o); \
+    mp_obj_dict_store(locals_dict, n, MP_OBJ_FROM_PTR(o)); \
 }
 
 
@@ -54,7 +54,7 @@
     o->base.type = &mp_type_fun_builtin_3; \
     o->fun._3 = CB; \
     auto n = MP_OBJ_NEW_QSTR(qstr_from_str(NAME)); \
-    mp_obj_dict_store(locals_dict, n, o); \
+    mp_obj_dict_store(locals_dict, n, MP_OBJ_FROM_PTR(o)); \
 }
 
 
@@ -66,7 +66,7 @@
     o->n_args_max = ARG_MAX; \
     o->fun.var = CB; \
     auto n = MP_OBJ_NEW_QSTR(qstr_from_str(NAME)); \
-    mp_obj_dict_store(locals_dict, n, o); \
+    mp_obj_dict_store(locals_dict, n, MP_OBJ_FROM_PTR(o)); \
 }
 
 
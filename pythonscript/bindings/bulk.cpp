@@ -0,0 +1,179 @@
+// Godot imports
+#include "servers/visual_server.h"
+#include "scene/resources/multimesh.h"
+// Pythonscript imports
+#include "bindings/bulk.h"
+#include "bindings/dynamic_binder.h"
+#include "bindings/builtins_binder/rid.h"
+
+
+#define TRANSFORM_STRIDE 12
+#define COLOR_STRIDE 4
+
+
+// Buffer of floats as provided by `array.array('f')`, `array.array('d')`
+// or a memoryview on them
+struct _float_buffer_t {
+    mp_buffer_info_t info;
+    size_t len;
+
+    _FORCE_INLINE_ real_t get(size_t i) const {
+        if (info.typecode == 'f') {
+            return static_cast<const float *>(info.buf)[i];
+        } else {
+            return static_cast<const double *>(info.buf)[i];
+        }
+    }
+
+    _FORCE_INLINE_ void set(size_t i, real_t value) {
+        if (info.typecode == 'f') {
+            static_cast<float *>(info.buf)[i] = value;
+        } else {
+            static_cast<double *>(info.buf)[i] = value;
+        }
+    }
+};
+
+
+static void _get_float_buffer(mp_obj_t pyobj, _float_buffer_t *buffer, const char *name, int flags=MP_BUFFER_READ) {
+    mp_get_buffer_raise(pyobj, &buffer->info, flags);
+    if (buffer->info.typecode == 'f') {
+        buffer->len = buffer->info.len / sizeof(float);
+    } else if (buffer->info.typecode == 'd') {
+        buffer->len = buffer->info.len / sizeof(double);
+    } else {
+        nlr_raise(mp_obj_new_exception_msg_varg(&mp_type_TypeError,
+            "%s must be a buffer of floats (typecode 'f' or 'd')", name));
+    }
+}
+
+
+static RID _retrieve_multimesh_rid(mp_obj_t pyobj) {
+    auto rid_binder = RIDBinder::get_singleton();
+    if (MP_OBJ_IS_TYPE(pyobj, rid_binder->get_mp_type())) {
+        return static_cast<RIDBinder::mp_godot_bind_t *>(MP_OBJ_TO_PTR(pyobj))->godot_rid;
+    }
+    if (DynamicBinder::is_dynamic_type(mp_obj_get_type(pyobj))) {
+        auto obj = static_cast<DynamicBinder::mp_godot_bind_t *>(MP_OBJ_TO_PTR(pyobj));
+        MultiMesh *multimesh = obj->godot_obj ? obj->godot_obj->cast_to<MultiMesh>() : NULL;
+        if (multimesh) {
+            return multimesh->get_rid();
+        }
+    }
+    mp_raise_TypeError("multimesh must be a MultiMesh or a RID");
+}
+
+
+// multimesh_set_instance_transforms(multimesh, transforms, colors=None)
+// `transforms` holds 12 floats per instance (the 3 basis rows then the
+// origin), `colors` 4 floats (r, g, b, a) per instance.
+static mp_obj_t _multimesh_set_instance_transforms(size_t n_args, const mp_obj_t *args) {
+    const RID multimesh = _retrieve_multimesh_rid(args[0]);
+    _float_buffer_t transforms;
+    _get_float_buffer(args[1], &transforms, "transforms");
+    if (transforms.len % TRANSFORM_STRIDE) {
+        mp_raise_ValueError("transforms size must be a multiple of 12");
+    }
+    const size_t count = transforms.len / TRANSFORM_STRIDE;
+
+    _float_buffer_t colors;
+    const bool has_colors = n_args == 3 && args[2] != mp_const_none;
+    if (has_colors) {
+        _get_float_buffer(args[2], &colors, "colors");
+        if (colors.len != count * COLOR_STRIDE) {
+            mp_raise_ValueError("colors must provide 4 floats per transform");
+        }
+    }
+
+    VisualServer *vs = VisualServer::get_singleton();
+    if (count > static_cast<size_t>(vs->multimesh_get_instance_count(multimesh))) {
+        mp_raise_ValueError("more transforms than multimesh instances");
+    }
+
+    // Everything has been checked, now copy straight into the server
+    for (size_t i = 0; i < count; ++i) {
+        const size_t t = i * TRANSFORM_STRIDE;
+        vs->multimesh_instance_set_transform(multimesh, i, Transform(
+            transforms.get(t + 0), transforms.get(t + 1), transforms.get(t + 2),
+            transforms.get(t + 3), transforms.get(t + 4), transforms.get(t + 5),
+            transforms.get(t + 6), transforms.get(t + 7), transforms.get(t + 8),
+            transforms.get(t + 9), transforms.get(t + 10), transforms.get(t + 11)));
+    }
+    if (has_colors) {
+        for (size_t i = 0; i < count; ++i) {
+            const size_t c = i * COLOR_STRIDE;
+            vs->multimesh_instance_set_color(multimesh, i, Color(
+                colors.get(c + 0), colors.get(c + 1), colors.get(c + 2), colors.get(c + 3)));
+        }
+    }
+    return mp_obj_new_int(count);
+}
+
+
+// multimesh_get_instance_transforms(multimesh, transforms, colors=None)
+// Reverse of `multimesh_set_instance_transforms`, fills the writable
+// `transforms` (and `colors`) buffers with the instances' values.
+static mp_obj_t _multimesh_get_instance_transforms(size_t n_args, const mp_obj_t *args) {
+    const RID multimesh = _retrieve_multimesh_rid(args[0]);
+    _float_buffer_t transforms;
+    _get_float_buffer(args[1], &transforms, "transforms", MP_BUFFER_WRITE);
+    if (transforms.len % TRANSFORM_STRIDE) {
+        mp_raise_ValueError("transforms size must be a multiple of 12");
+    }
+    const size_t count = transforms.len / TRANSFORM_STRIDE;
+
+    _float_buffer_t colors;
+    const bool has_colors = n_args == 3 && args[2] != mp_const_none;
+    if (has_colors) {
+        _get_float_buffer(args[2], &colors, "colors", MP_BUFFER_WRITE);
+        if (colors.len != count * COLOR_STRIDE) {
+            mp_raise_ValueError("colors must provide 4 floats per transform");
+        }
+    }
+
+    VisualServer *vs = VisualServer::get_singleton();
+    if (count > static_cast<size_t>(vs->multimesh_get_instance_count(multimesh))) {
+        mp_raise_ValueError("more transforms than multimesh instances");
+    }
+
+    for (size_t i = 0; i < count; ++i) {
+        const size_t t = i * TRANSFORM_STRIDE;
+        const Transform transform = vs->multimesh_instance_get_transform(multimesh, i);
+        for (int row = 0; row < 3; ++row) {
+            for (int column = 0; column < 3; ++column) {
+                transforms.set(t + row * 3 + column, transform.basis[row][column]);
+            }
+            transforms.set(t + 9 + row, transform.origin[row]);
+        }
+    }
+    if (has_colors) {
+        for (size_t i = 0; i < count; ++i) {
+            const size_t c = i * COLOR_STRIDE;
+            const Color color = vs->multimesh_instance_get_color(multimesh, i);
+            colors.set(c + 0, color.r);
+            colors.set(c + 1, color.g);
+            colors.set(c + 2, color.b);
+            colors.set(c + 3, color.a);
+        }
+    }
+    return mp_obj_new_int(count);
+}
+
+
+void bind_bulk_functions(mp_obj_t module) {
+    auto o = m_new_obj(mp_obj_fun_builtin_var_t);
+    o->base.type = &mp_type_fun_builtin_var;
+    o->is_kw = false;
+    o->n_args_min = 2;
+    o->n_args_max = 3;
+    o->fun.var = _multimesh_set_instance_transforms;
+    mp_store_attr(module, qstr_from_str("multimesh_set_instance_transforms"), MP_OBJ_FROM_PTR(o));
+
+    o = m_new_obj(mp_obj_fun_builtin_var_t);
+    o->base.type = &mp_type_fun_builtin_var;
+    o->is_kw = false;
+    o->n_args_min = 2;
+    o->n_args_max = 3;
+    o->fun.var = _multimesh_get_instance_transforms;
+    mp_store_attr(module, qstr_from_str("multimesh_get_instance_transforms"), MP_OBJ_FROM_PTR(o));
+}
@@ -0,0 +1,13 @@
+#ifndef PYTHONSCRIPT_BULK_H
+#define PYTHONSCRIPT_BULK_H
+
+// Micropython imports
+#include "micropython/micropython.h"
+
+
+// Store into `module` the functions allowing to upload big chunks of
+// data (e.g. MultiMesh instances) to and from Godot in a single python call
+void bind_bulk_functions(mp_obj_t module);
+
+
+#endif  // PYTHONSCRIPT_BULK_H
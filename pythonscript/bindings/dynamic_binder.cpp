@@ -3,7 +3,9 @@
 // Pythonscript imports
 #include "bindings/dynamic_binder.h"
 #include "bindings/builtins_binder/atomic.h"
+#include "bindings/builtins_binder/node_path.h"
 #include "bindings/tools.h"
+#include "py_perf.h"
 
 
 // Generate a python function calling `callback` with data as first
@@ -53,56 +55,80 @@ static mp_obj_t _generate_custom_trampoline(mp_obj_t callback, mp_obj_t data) {
 
         return trampoline;
     } else {
-        mp_obj_print_exception(&mp_plat_print, (mp_obj_t)nlr.ret_val);
+        mp_obj_print_exception(&mp_plat_print, MP_OBJ_FROM_PTR(nlr.ret_val));
         // uncaught exception
         return mp_const_none;
     }
 }
 
 
-static mp_obj_t _wrap_godot_method(StringName type_name, StringName method_name) {
+static uint32_t _compute_node_path_args(const MethodInfo &info) {
+    uint32_t mask = 0;
+    int i = 0;
+    for(const List<PropertyInfo>::Element *E=info.arguments.front(); E && i < 32; E=E->next(), ++i) {
+        if (E->get().type == Variant::NODE_PATH) {
+            mask |= 1u << i;
+        }
+    }
+    if (info.arguments.empty()) {
+        // Arguments' types are only provided by ClassDB when
+        // DEBUG_METHODS_ENABLED is set, fallback on the usual suspects
+        const String name = info.name;
+        if (name == "get_node" || name == "has_node" ||
+                name == "get_node_and_resource" || name == "has_node_and_resource") {
+            mask = 1;
+        }
+    }
+    return mask;
+}
+
+
+static mp_obj_t _wrap_godot_method(DynamicBinder::method_info_t *p_info) {
     // TODO: micropython doesn't allow to store a name for native functions
     // TODO: don't use `m_new_obj` but good old' `malloc` to avoid useless
     // python gc work on those stay-forever functions
-    auto p_method_bind = ClassDB::get_method(type_name, method_name);
-    // It seems methods starting with "_" are considered private so ignore them
-    if (!p_method_bind) {
-        WARN_PRINTS("--- Bad Binding " + String(type_name) + ":" + String(method_name));
-        return mp_const_none;
-    // } else {
-    //     WARN_PRINTS("+++ Good Binding " + String(type_name) + ":" + String(method_name));
-    }
+    auto p_method_bind = p_info->method_bind;
 
     // Define the wrapper function that is responsible to:
     // - Convert arguments to python obj
-    // - Call the godot method from p_method_bind pointer passed as first argument
+    // - Call the godot method from p_info pointer passed as first argument
     // - Convert back result to Variant
     // - Handle call errors as python exceptions
     auto caller_fun = m_new_obj(mp_obj_fun_builtin_var_t);
     caller_fun->base.type = &mp_type_fun_builtin_var;
     caller_fun->is_kw = false;
     // Godot doesn't count self as an argument but python does
-    // we will also be passed `p_method_bind` by the trampoline caller
-    caller_fun->n_args_min = p_method_bind->get_argument_count() + 2;
+    // we will also be passed `p_info` by the trampoline caller.
+    // Missing trailing arguments are filled by MethodBind::call from
+    // the default arguments.
+    caller_fun->n_args_min = p_method_bind->get_argument_count() - p_method_bind->get_default_argument_count() + 2;
     caller_fun->n_args_max = p_method_bind->get_argument_count() + 2;
     caller_fun->fun.var = [](size_t n, const mp_obj_t *args) -> mp_obj_t {
-        // First arg is the p_method_bind
-        auto p_method_bind = static_cast<MethodBind *>(args[0]);
+        // First arg is the p_info
+        auto p_info = static_cast<DynamicBinder::method_info_t *>(MP_OBJ_TO_PTR(args[0]));
+        PY_PERF_COUNT(METHOD_CALL);
         auto self = static_cast<DynamicBinder::mp_godot_bind_t *>(MP_OBJ_TO_PTR(args[1]));
-        // Remove self and also don't pass p_method_bind as argument
+        // Remove self and also don't pass p_info as argument
         const int godot_n = n - 2;
         const Variant def_arg;
         const Variant *godot_args[godot_n];
         auto bindings = GodotBindingsModule::get_singleton();
         for (int i = 0; i < godot_n; ++i) {
-            godot_args[i] = new Variant(bindings->pyobj_to_variant(args[i+2]));
+            const mp_obj_t arg = args[i+2];
+            if ((p_info->node_path_args & (1u << i)) && MP_OBJ_IS_STR(arg)) {
+                // Don't let Godot parse the string into a NodePath each time
+                godot_args[i] = new Variant(NodePathBinder::get_singleton()->pyobj_to_node_path(arg));
+            } else {
+                godot_args[i] = new Variant(bindings->pyobj_to_variant(arg));
+            }
         }
         Variant::CallError err;
-        Variant ret = p_method_bind->call(self->godot_obj, godot_args, godot_n, err);
+        Variant ret = p_info->method_bind->call(self->godot_obj, godot_args, godot_n, err);
         for (int i = 0; i < godot_n; ++i) {
             delete godot_args[i];
         }
         if (err.error != Variant::CallError::CALL_OK) {
+            PY_PERF_COUNT(EXCEPTION);
             // Throw exception
             // TODO: improve error message...
             nlr_raise(mp_obj_new_exception_msg(&mp_type_RuntimeError, "Tough shit dude..."));
@@ -110,8 +136,9 @@ static mp_obj_t _wrap_godot_method(StringName type_name, StringName method_name)
         return bindings->variant_to_pyobj(ret);
     };
 
-    // Yes, p_method_bind is not an mp_obj_t... but it's only to pass to caller_fun
-    auto trampoline = _generate_custom_trampoline(caller_fun, static_cast<mp_obj_t>(p_method_bind));
+    // Yes, p_info is not an mp_obj_t... but it's only to pass to caller_fun
+    // (boxed as a pointer, the GC ignores it given it's not in the heap)
+    auto trampoline = _generate_custom_trampoline(MP_OBJ_FROM_PTR(caller_fun), MP_OBJ_FROM_PTR(p_info));
 
     return trampoline;
 }
@@ -121,15 +148,17 @@ static mp_obj_t _wrap_godot_property_getter(StringName *property_name) {
     auto caller_fun = m_new_obj(_mp_obj_fun_builtin_fixed_t);
     caller_fun->base.type = &mp_type_fun_builtin_2;
     caller_fun->fun._2 = [](mp_obj_t mp_name, mp_obj_t mp_self) -> mp_obj_t {
-        auto p_name = static_cast<StringName*>(mp_name);
+        auto p_name = static_cast<StringName*>(MP_OBJ_TO_PTR(mp_name));
         auto self = static_cast<DynamicBinder::mp_godot_bind_t *>(MP_OBJ_TO_PTR(mp_self));
+        PY_PERF_COUNT(PROPERTY_GET);
         Variant ret;
         if (!ClassDB::get_property(self->godot_obj, *p_name, ret)) {
+            PY_PERF_COUNT(EXCEPTION);
             nlr_raise(mp_obj_new_exception_msg(&mp_type_RuntimeError, "Tough shit dude..."));
         }
         return GodotBindingsModule::get_singleton()->variant_to_pyobj(ret);
     };
-    auto trampoline = _generate_custom_trampoline(caller_fun, static_cast<mp_obj_t>(property_name));
+    auto trampoline = _generate_custom_trampoline(MP_OBJ_FROM_PTR(caller_fun), MP_OBJ_FROM_PTR(property_name));
     return trampoline;
 }
 
@@ -138,21 +167,24 @@ static mp_obj_t _wrap_godot_property_setter(StringName *property_name) {
     auto caller_fun = m_new_obj(_mp_obj_fun_builtin_fixed_t);
     caller_fun->base.type = &mp_type_fun_builtin_3;
     caller_fun->fun._3 = [](mp_obj_t mp_name, mp_obj_t mp_self, mp_obj_t mp_value) -> mp_obj_t {
-        auto p_name = static_cast<StringName*>(mp_name);
+        auto p_name = static_cast<StringName*>(MP_OBJ_TO_PTR(mp_name));
         auto self = static_cast<DynamicBinder::mp_godot_bind_t *>(MP_OBJ_TO_PTR(mp_self));
+        PY_PERF_COUNT(PROPERTY_SET);
         auto value = GodotBindingsModule::get_singleton()->pyobj_to_variant(mp_value);
         bool valid;
         if (!ClassDB::set_property(self->godot_obj, *p_name, value, &valid)) {
+            PY_PERF_COUNT(EXCEPTION);
             char buff[64];
             snprintf(buff, sizeof(buff), "'%s' has no attribute '%s'",
                      self->godot_obj->get_class().utf8().get_data(), String(*p_name).utf8().get_data());
             nlr_raise(mp_obj_new_exception_msg(&mp_type_AttributeError, buff));
         } else if (!valid) {
+            PY_PERF_COUNT(EXCEPTION);
             nlr_raise(mp_obj_new_exception_msg(&mp_type_RuntimeError, "Tough shit dude..."));
         }
         return mp_const_none;
     };
-    auto trampoline = _generate_custom_trampoline(caller_fun, static_cast<mp_obj_t>(property_name));
+    auto trampoline = _generate_custom_trampoline(MP_OBJ_FROM_PTR(caller_fun), MP_OBJ_FROM_PTR(property_name));
     return trampoline;
 }
 
@@ -162,6 +194,7 @@ static mp_obj_t _type_make_new(const mp_obj_type_t *type, mp_uint_t n_args, mp_u
     // TODO: Optimize this by using TypeInfo::creation_func ?
     // TODO: Handle constructor's parameters
     Object *godot_obj = ClassDB::instance(p_type_binder->get_type_name());
+    PY_PERF_COUNT(WRAPPER_ALLOC);
     DynamicBinder::mp_godot_bind_t *obj = m_new_obj_with_finaliser(DynamicBinder::mp_godot_bind_t);
     obj->base.type = type;
     obj->godot_obj = godot_obj;
@@ -228,12 +261,18 @@ void DynamicBinder::get_attr(mp_obj_t self_in, qstr attr, mp_obj_t *dest) const
 #endif
 
 
+bool DynamicBinder::is_dynamic_type(const mp_obj_type_t *type) {
+    return type->make_new == _type_make_new;
+}
+
+
 mp_obj_t DynamicBinder::build_pyobj() const {
     return this->build_pyobj(NULL);
 }
 
 
 mp_obj_t DynamicBinder::build_pyobj(Object *obj) const {
+    PY_PERF_COUNT(WRAPPER_ALLOC);
     mp_godot_bind_t *py_obj = m_new_obj_with_finaliser(mp_godot_bind_t);
     py_obj->base.type = this->get_mp_type();
     py_obj->godot_obj = obj;
@@ -266,7 +305,9 @@ DynamicBinder::~DynamicBinder() {
     for(auto *E=this->property_lookup.front();E;E=E->next()) {
         memdelete(E->value());
     }
-
+    for(auto *E=this->method_infos.front();E;E=E->next()) {
+        memdelete(E->get());
+    }
 }
 
 
@@ -298,7 +339,17 @@ DynamicBinder::DynamicBinder(StringName type_name) {
     for(List<MethodInfo>::Element *E=methods.front();E;E=E->next()) {
         const MethodInfo info = E->get();
         const auto qstr_name = qstr_from_str(info.name.utf8().get_data());
-        const auto mpo_method = _wrap_godot_method(type_name, info.name);
+        auto p_method_bind = ClassDB::get_method(type_name, info.name);
+        // It seems methods starting with "_" are considered private so ignore them
+        if (!p_method_bind) {
+            WARN_PRINTS("--- Bad Binding " + String(type_name) + ":" + String(info.name));
+            continue;
+        }
+        auto p_info = memnew(method_info_t);
+        p_info->method_bind = p_method_bind;
+        p_info->node_path_args = _compute_node_path_args(info);
+        this->method_infos.push_back(p_info);
+        const auto mpo_method = _wrap_godot_method(p_info);
         if (mpo_method != mp_const_none) {
             this->method_lookup.insert(qstr_name, mpo_method);
             mp_obj_dict_store(locals_dict, MP_OBJ_NEW_QSTR(qstr_name), mpo_method);
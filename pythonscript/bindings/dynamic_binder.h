@@ -13,10 +13,21 @@
 
 class DynamicBinder : public BaseBinder {
 
+public:
+
+    // Data passed to the python wrapper of a godot method
+    typedef struct {
+        MethodBind *method_bind;
+        // Bitmask of the arguments expecting a NodePath, python strings
+        // passed there are converted through NodePathBinder's cache
+        uint32_t node_path_args;
+    } method_info_t;
+
 private:
     // DynamicBinder *parent;  # TODO: useful ?
     Map<qstr, mp_obj_t> method_lookup;
     Map<qstr, StringName*> property_lookup;
+    List<method_info_t*> method_infos;
 
     // Type object of this godot type in python
     mp_obj_type_t _mp_type;
@@ -38,6 +49,9 @@ public:
     mp_obj_t build_pyobj(Object *obj) const;
     virtual Variant pyobj_to_variant(mp_obj_t pyobj) const;
     virtual mp_obj_t variant_to_pyobj(const Variant &p_variant) const;
+
+    // Whether the python type has been generated by a DynamicBinder
+    static bool is_dynamic_type(const mp_obj_type_t *type);
 };
 
 
@@ -1,9 +1,11 @@
 from os import path
 import subprocess
+from SCons.Script import ARGUMENTS
 
 
 MP_DIR = path.dirname(path.abspath(__file__)) + '/micropython'
 MP_TARGET = MP_DIR + "/libmicropython.a"
+MPY_CROSS_TARGET = MP_DIR + "/micropython/mpy-cross/mpy-cross"
 
 
 def can_build(platform):
@@ -11,10 +13,16 @@ def can_build(platform):
 
 
 def configure(env):
-    if not path.isfile(MP_TARGET):
-        print('Building libmicropython.a...')
-        cmd = ['make']
-        if env["target"] == "debug":
-            cmd.append('DEBUG=y')
-        subprocess.call(cmd, cwd=MP_DIR)
-        print('libmicropython.a successfully built !')
+    if not path.isfile(MPY_CROSS_TARGET):
+        # Needed to freeze the modules of micropython/modules into the lib
+        print('Building mpy-cross...')
+        subprocess.call(['make', 'mpy-cross'], cwd=MP_DIR)
+    # Always run make given it only rebuilds the frozen modules if they changed
+    print('Building libmicropython.a...')
+    cmd = ['make']
+    if env["target"] == "debug":
+        cmd.append('DEBUG=y')
+    if ARGUMENTS.get('PYTHONSCRIPT_NANBOX', 'no') == 'yes':
+        cmd.append('NANBOX=1')
+    subprocess.call(cmd, cwd=MP_DIR)
+    print('libmicropython.a successfully built !')
@@ -11,6 +11,8 @@ extern "C" {
 #include "py/stackctrl.h"
 #include "py/objmodule.h"
 #include "py/objtype.h"
+#include "py/persistentcode.h"
+#include "mphandlers.h"
 
 // Bonus functions !
 mp_obj_t mp_execute_from_lexer(mp_lexer_t *lex);
@@ -30,7 +32,7 @@ mp_obj_t mp_execute_expr(const char *str);
       f(); \
       nlr_pop(); \
     } else { \
-      ex(nlr.ret_val); \
+      ex(MP_OBJ_FROM_PTR(nlr.ret_val)); \
     }
 
 
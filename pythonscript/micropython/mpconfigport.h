@@ -27,14 +27,24 @@
 // options to control how Micro Python is built
 
 #define MICROPY_ALLOC_PATH_MAX      (PATH_MAX)
+#ifdef PYTHONSCRIPT_NANBOX
+// NaN-boxing: floats are stored in the 64-bit object itself instead of being
+// heap allocated. Pointers must fit in the low 48 bits of the object, which
+// holds for user space on x86-64 and aarch64 (see NANBOX in the Makefile)
+#define MICROPY_OBJ_REPR            (MICROPY_OBJ_REPR_D)
+#endif
 #define MICROPY_ENABLE_GC           (1)
 #define MICROPY_ENABLE_FINALISER    (1)
 #define MICROPY_STACK_CHECK         (0)  // TODO: disable on release ?
 #define MICROPY_COMP_CONST          (1)
+// Compiled modules are cached on disk (see py_bytecode_cache.h)
+#define MICROPY_PERSISTENT_CODE_LOAD (1)
+#define MICROPY_PERSISTENT_CODE_SAVE (1)
 #define MICROPY_MEM_STATS           (0)
 #define MICROPY_DEBUG_PRINTERS      (0)
 #define MICROPY_HELPER_REPL         (1)
-#define MICROPY_HELPER_LEXER_UNIX   (1)
+// Python files are read through Godot's FileAccess (see py_import.cpp)
+#define MICROPY_READER_POSIX        (0)
 #define MICROPY_ENABLE_SOURCE_LINE  (1)
 #define MICROPY_ERROR_REPORTING     (MICROPY_ERROR_REPORTING_DETAILED)
 #define MICROPY_WARNINGS            (1)
@@ -44,6 +54,15 @@
 #define MICROPY_STREAMS_NON_BLOCK   (1)
 #define MICROPY_OPT_COMPUTED_GOTO   (1)
 #define MICROPY_OPT_CACHE_MAP_LOOKUP_IN_BYTECODE (1)
+// Functions decorated with `@micropython.native` or `@micropython.viper` are
+// compiled to machine code (only the x86-64 System V emitter is enabled)
+// (native emitters don't support NaN-boxing)
+#if defined(__x86_64__) && defined(__linux__) && !defined(PYTHONSCRIPT_NANBOX)
+#define MICROPY_EMIT_X64            (1)
+#endif
+// godot.py & co are frozen into the library (see FROZEN_MPY_DIR in the Makefile)
+#define MICROPY_MODULE_FROZEN_MPY   (1)
+#define MICROPY_QSTR_EXTRA_POOL     mp_qstr_frozen_const_pool
 #define MICROPY_CAN_OVERRIDE_BUILTINS (1)
 #define MICROPY_BUILTIN_METHOD_CHECK_SELF_ARG (1) // TODO: disable on release ?
 #define MICROPY_CPYTHON_COMPAT      (1)
@@ -156,12 +175,17 @@ extern const struct _mp_obj_module_t mp_module_os;
     // { MP_ROM_QSTR(MP_QSTR_input), MP_ROM_PTR(&mp_builtin_input_obj) },
 
 #define MICROPY_PORT_BUILTIN_MODULES \
-    { MP_OBJ_NEW_QSTR(MP_QSTR_uos), (mp_obj_t)&mp_module_os }, \
+    { MP_ROM_QSTR(MP_QSTR_uos), MP_ROM_PTR(&mp_module_os) }, \
 
 #define MP_STATE_PORT MP_STATE_VM
 
+// Native code lives in mmap'ed executable memory (see unix/alloc.c)
+#define MP_PLAT_ALLOC_EXEC(min_size, ptr, size) mp_unix_alloc_exec(min_size, ptr, size)
+#define MP_PLAT_FREE_EXEC(ptr, size) mp_unix_free_exec(ptr, size)
+
 #define MICROPY_PORT_ROOT_POINTERS \
     mp_obj_t keyboard_interrupt_obj; \
+    void *mmap_region_head; \
     mp_obj_dict_t godot_references;
 
 //////////////////////////////////////////
@@ -183,6 +207,13 @@ extern const struct _mp_obj_module_t mp_module_os;
 #ifdef __LP64__
 typedef long mp_int_t; // must be pointer size
 typedef unsigned long mp_uint_t; // must be pointer size
+#elif defined(PYTHONSCRIPT_NANBOX)
+#include <stdint.h>
+// Objects are 64 bits wide
+typedef int64_t mp_int_t;
+typedef uint64_t mp_uint_t;
+#define UINT_FMT "%llu"
+#define INT_FMT "%lld"
 #else
 // These are definitions for machines where sizeof(int) == sizeof(void*),
 // regardless for actual size.
@@ -192,6 +223,9 @@ typedef unsigned int mp_uint_t; // must be pointer size
 
 #define BYTES_PER_WORD sizeof(mp_int_t)
 
+void mp_unix_alloc_exec(mp_uint_t min_size, void** ptr, mp_uint_t *size);
+void mp_unix_free_exec(void *ptr, mp_uint_t size);
+
 // Cannot include <sys/types.h>, as it may lead to symbol name clashes
 #if _FILE_OFFSET_BITS == 64 && !defined(__LP64__)
 typedef long long mp_off_t;
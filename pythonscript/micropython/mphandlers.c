@@ -1,25 +1,54 @@
 #include <stdlib.h>
 #include <stdio.h>
 #include <string.h>
-#include <sys/stat.h>
+#include <setjmp.h>
+#include <time.h>
 
 #include "micropython/py/lexer.h"
 #include "micropython/py/runtime.h"
 #include "micropython/py/compile.h"
+#include "micropython/py/gc.h"
+#include "micropython/py/mpstate.h"
+#include "mphandlers.h"
 
 
 /* Needed by micropython */
 
-uint mp_import_stat(const char *path) {
-    struct stat st;
-    if (stat(path, &st) == 0) {
-        if (S_ISDIR(st.st_mode)) {
-            return MP_IMPORT_STAT_DIR;
-        } else if (S_ISREG(st.st_mode)) {
-            return MP_IMPORT_STAT_FILE;
-        }
-    }
-    return MP_IMPORT_STAT_NO_EXIST;
+// mp_import_stat & the file reader are in py_import.cpp
+
+
+mp_gc_stats_t mp_gc_stats = {0, 0, 0};
+
+
+static uint64_t _ticks_usec(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000 + ts.tv_nsec / 1000;
+}
+
+
+#if MICROPY_EMIT_NATIVE
+void mp_unix_mark_exec(void);
+#endif
+
+
+// Replaces unix/gccollect.c to keep track of the collections count and pauses
+void gc_collect(void) {
+    const uint64_t start = _ticks_usec();
+    gc_collect_start();
+    // Spill registers on the stack so they get scanned as roots
+    jmp_buf regs;
+    setjmp(regs);
+    void **regs_ptr = (void**)(void*)&regs;
+    gc_collect_root(regs_ptr, ((uintptr_t)MP_STATE_THREAD(stack_top) - (uintptr_t)&regs) / sizeof(uintptr_t));
+#if MICROPY_EMIT_NATIVE
+    mp_unix_mark_exec();
+#endif
+    gc_collect_end();
+    const uint64_t pause = _ticks_usec() - start;
+    mp_gc_stats.collections++;
+    mp_gc_stats.last_pause_usec = pause;
+    mp_gc_stats.total_pause_usec += pause;
 }
 
 
@@ -46,9 +75,9 @@ mp_obj_t mp_execute_from_lexer(mp_lexer_t *lex, mp_parse_input_kind_t input_kind
         nlr_pop();
         return mp_const_none;
     } else {
-        mp_obj_print_exception(&mp_plat_print, (mp_obj_t)nlr.ret_val);
+        mp_obj_print_exception(&mp_plat_print, MP_OBJ_FROM_PTR(nlr.ret_val));
         // uncaught exception
-        return (mp_obj_t)nlr.ret_val;
+        return MP_OBJ_FROM_PTR(nlr.ret_val);
     }
 }
 
@@ -0,0 +1,20 @@
+#ifndef MPHANDLERS_H
+#define MPHANDLERS_H
+
+#include <stdint.h>
+
+#include "py/mpconfig.h"
+
+
+// Collections done by `gc_collect`, which is provided by mphandlers.c
+// instead of micropython's unix/gccollect.c
+typedef struct {
+    mp_uint_t collections;
+    uint64_t last_pause_usec;
+    uint64_t total_pause_usec;
+} mp_gc_stats_t;
+
+extern mp_gc_stats_t mp_gc_stats;
+
+
+#endif // MPHANDLERS_H
@@ -0,0 +1,95 @@
+// Godot imports
+#include "core/os/memory.h"
+#ifdef TOOLS_ENABLED
+#include "core/engine.h"
+#endif
+// Microphython
+extern "C" {
+#include "py/bc.h"
+#include "py/emitglue.h"
+}
+// Pythonscript imports
+#include "py_bytecode_arena.h"
+
+
+#define PYTHONSCRIPT_BYTECODE_ARENA_CHUNK_SIZE (64 * 1024)
+
+
+Vector<uint8_t *> PyBytecodeArena::_chunks;
+uint8_t *PyBytecodeArena::_current_chunk = NULL;
+size_t PyBytecodeArena::_chunk_used = 0;
+size_t PyBytecodeArena::_size = 0;
+
+
+byte *PyBytecodeArena::_alloc(size_t p_size) {
+    _size += p_size;
+    if (p_size > PYTHONSCRIPT_BYTECODE_ARENA_CHUNK_SIZE / 4) {
+        // Big enough to get its own chunk, keep filling the current one
+        uint8_t *chunk = static_cast<uint8_t *>(memalloc(p_size));
+        _chunks.push_back(chunk);
+        return chunk;
+    }
+    if (!_current_chunk || _chunk_used + p_size > PYTHONSCRIPT_BYTECODE_ARENA_CHUNK_SIZE) {
+        _current_chunk = static_cast<uint8_t *>(memalloc(PYTHONSCRIPT_BYTECODE_ARENA_CHUNK_SIZE));
+        _chunks.push_back(_current_chunk);
+        _chunk_used = 0;
+    }
+    byte *ptr = _current_chunk + _chunk_used;
+    _chunk_used += p_size;
+    return ptr;
+}
+
+
+static bool _is_in_gc_heap(const void *p_ptr) {
+    return p_ptr >= MP_STATE_MEM(gc_pool_start) && p_ptr < MP_STATE_MEM(gc_pool_end);
+}
+
+
+void PyBytecodeArena::relocate(mp_raw_code_t *p_raw_code) {
+    if (p_raw_code->kind != MP_CODE_BYTECODE) {
+        return;
+    }
+#ifdef TOOLS_ENABLED
+    // The editor reloads scripts on each change, the arena would keep every
+    // version of them until shutdown. Leave the bytecode to the GC instead
+    if (Engine::get_singleton()->is_editor_hint()) {
+        return;
+    }
+#endif
+    const byte *bytecode = p_raw_code->data.u_byte.bytecode;
+    // Frozen modules' bytecode is already out of the heap
+    if (!_is_in_gc_heap(bytecode)) {
+        return;
+    }
+
+    // The prelude gives the number of arguments, whose names are at the
+    // beginning of the const table (followed by the objects, then the children)
+    const byte *ip = bytecode;
+    mp_decode_uint(&ip); // n_state
+    mp_decode_uint(&ip); // n_exc_stack
+    ip++; // scope_flags
+    const size_t n_pos_args = *ip++;
+    const size_t n_kwonly_args = *ip++;
+    const mp_uint_t *children = p_raw_code->data.u_byte.const_table +
+        n_pos_args + n_kwonly_args + p_raw_code->data.u_byte.n_obj;
+    for (size_t i = 0; i < p_raw_code->data.u_byte.n_raw_code; ++i) {
+        relocate(reinterpret_cast<mp_raw_code_t *>(static_cast<uintptr_t>(children[i])));
+    }
+
+    const size_t bc_len = p_raw_code->data.u_byte.bc_len;
+    byte *relocated = _alloc(bc_len);
+    memcpy(relocated, bytecode, bc_len);
+    p_raw_code->data.u_byte.bytecode = relocated;
+    m_del(byte, const_cast<byte *>(bytecode), bc_len);
+}
+
+
+void PyBytecodeArena::clear() {
+    for (int i = 0; i < _chunks.size(); ++i) {
+        memfree(_chunks[i]);
+    }
+    _chunks.clear();
+    _current_chunk = NULL;
+    _chunk_used = 0;
+    _size = 0;
+}
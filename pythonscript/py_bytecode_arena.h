@@ -0,0 +1,43 @@
+#ifndef PYTHONSCRIPT_PY_BYTECODE_ARENA_H
+#define PYTHONSCRIPT_PY_BYTECODE_ARENA_H
+
+// Microphython
+#include "micropython/micropython.h"
+// Godot imports
+#include "core/vector.h"
+
+
+/**
+ * Storage for the scripts' bytecode out of the GC heap, so it doesn't count
+ * against `python_script/heap_size` nor gets scanned by the collector (like
+ * frozen modules' bytecode).
+ * Bytecode can't be executed straight from the cache file given loading
+ * patches its qstrs, so it is moved here once loaded. Bytecode holds no
+ * object references (they are in the const tables, which stay in the heap)
+ * hence the GC doesn't need to see it.
+ * Functions may outlive their script, so memory is only released when the
+ * interpreter shuts down. For this reason the editor, which reloads scripts
+ * as they are edited, keeps the bytecode in the GC heap.
+ */
+class PyBytecodeArena {
+
+    static Vector<uint8_t *> _chunks;
+    static uint8_t *_current_chunk;
+    static size_t _chunk_used;
+    static size_t _size;
+
+    static byte *_alloc(size_t p_size);
+
+public:
+
+    // Move the bytecode of `p_raw_code` and its children (functions, classes...)
+    // here, to be called before creating functions out of it.
+    // Doesn't raise python exceptions.
+    static void relocate(mp_raw_code_t *p_raw_code);
+    // Bytes of bytecode stored
+    _FORCE_INLINE_ static size_t get_size() { return _size; }
+    static void clear();
+};
+
+
+#endif // PYTHONSCRIPT_PY_BYTECODE_ARENA_H
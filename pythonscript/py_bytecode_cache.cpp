@@ -0,0 +1,147 @@
+#include <cstring>
+
+// Godot imports
+#include "core/globals.h"
+#include "core/os/dir_access.h"
+#include "core/os/file_access.h"
+#include "core/io/md5.h"
+#ifdef TOOLS_ENABLED
+#include "core/engine.h"
+#endif
+// Microphython
+#include "micropython/micropython.h"
+#include "genhdr/mpversion.h"
+// Pythonscript imports
+#include "py_bytecode_cache.h"
+
+
+// Bump this when the way modules are compiled changes
+#define PYTHONSCRIPT_BYTECODE_CACHE_VERSION "1"
+#define PYTHONSCRIPT_BYTECODE_CACHE_MAGIC "PYSCRIPT_MPY"
+
+
+String PyBytecodeCache::compute_key(const Vector<uint8_t> &p_source) {
+    MD5_CTX ctx;
+    MD5Init(&ctx);
+    MD5Update(&ctx, const_cast<unsigned char *>(p_source.ptr()), p_source.size());
+    MD5Final(&ctx);
+    return String(PYTHONSCRIPT_BYTECODE_CACHE_MAGIC " " PYTHONSCRIPT_BYTECODE_CACHE_VERSION " "
+                  MICROPY_VERSION_STRING " ") + String::md5(ctx.digest);
+}
+
+
+Vector<uint8_t> PyBytecodeCache::encode_source(const String &p_source) {
+    const CharString source_utf8 = p_source.utf8();
+    Vector<uint8_t> buffer;
+    buffer.resize(source_utf8.length());
+    copymem(buffer.ptr(), source_utf8.get_data(), source_utf8.length());
+    return buffer;
+}
+
+
+String PyBytecodeCache::get_cache_path(const String &p_script_path, const String &p_module_path) {
+#ifdef TOOLS_ENABLED
+    if (Engine::get_singleton()->is_editor_hint()) {
+        return p_script_path.get_base_dir().plus_file("__pycache__").plus_file(p_script_path.get_file().get_basename() + ".pyc");
+    }
+#endif
+    const String cache_dir = GlobalConfig::get_singleton()->get("python_script/bytecode_cache/path");
+    return cache_dir.plus_file(p_module_path + ".pyc");
+}
+
+
+Vector<uint8_t> PyBytecodeCache::load(const String &p_cache_path, const String &p_key) {
+    Vector<uint8_t> bytecode;
+    FileAccess *file = FileAccess::open(p_cache_path, FileAccess::READ);
+    if (!file) {
+        return bytecode;
+    }
+    const CharString expected_header = p_key.utf8();
+    const int header_len = expected_header.length() + 1;
+    const int len = file->get_len();
+    if (len > header_len) {
+        Vector<uint8_t> header;
+        header.resize(header_len);
+        file->get_buffer(header.ptr(), header_len);
+        if (!memcmp(header.ptr(), expected_header.get_data(), header_len - 1) && header[header_len - 1] == '\n') {
+            bytecode.resize(len - header_len);
+            file->get_buffer(bytecode.ptr(), len - header_len);
+        }
+    }
+    memdelete(file);
+    return bytecode;
+}
+
+
+Error PyBytecodeCache::save(const String &p_cache_path, const String &p_key, const Vector<uint8_t> &p_bytecode) {
+    const String cache_dir = p_cache_path.get_base_dir();
+    DirAccess *dir = DirAccess::create_for_path(cache_dir);
+    if (!dir->dir_exists(cache_dir)) {
+        dir->make_dir_recursive(cache_dir);
+    }
+
+    Error err;
+    FileAccess *file = FileAccess::open(p_cache_path, FileAccess::WRITE, &err);
+    if (err != OK) {
+        memdelete(dir);
+        ERR_FAIL_V(err);
+    }
+    const CharString header = p_key.utf8();
+    file->store_buffer(reinterpret_cast<const uint8_t *>(header.get_data()), header.length());
+    file->store_8('\n');
+    file->store_buffer(p_bytecode.ptr(), p_bytecode.size());
+    err = file->get_error();
+    memdelete(file);
+    if (err != OK && err != ERR_FILE_EOF) {
+        // Don't leave a truncated entry behind
+        dir->remove(p_cache_path);
+        err = ERR_CANT_CREATE;
+    } else {
+        err = OK;
+    }
+    memdelete(dir);
+    return err;
+}
+
+
+static void _raw_code_save_strn(void *p_env, const char *p_str, size_t p_len) {
+    auto bytecode = static_cast<Vector<uint8_t> *>(p_env);
+    const int offset = bytecode->size();
+    bytecode->resize(offset + p_len);
+    memcpy(bytecode->ptr() + offset, p_str, p_len);
+}
+
+
+bool PyBytecodeCache::save_raw_code(mp_raw_code_t *p_raw_code, Vector<uint8_t> *r_bytecode) {
+    mp_print_t print = {r_bytecode, _raw_code_save_strn};
+    nlr_buf_t nlr;
+    if (nlr_push(&nlr) == 0) {
+        mp_raw_code_save(p_raw_code, &print);
+        nlr_pop();
+        return true;
+    }
+    // Native functions (`@micropython.native/viper`) have no .mpy representation
+    r_bytecode->clear();
+    return false;
+}
+
+
+Error PyBytecodeCache::compile(const Vector<uint8_t> &p_source, const String &p_source_name, Vector<uint8_t> *r_bytecode) {
+    const qstr source_name = qstr_from_str(p_source_name.utf8().get_data());
+    mp_obj_t error = 0;
+    auto compile_module = [&p_source, source_name, r_bytecode]() {
+        const char *src = p_source.size() ? reinterpret_cast<const char *>(p_source.ptr()) : "";
+        mp_lexer_t *lex = mp_lexer_new_from_str_len(source_name, src, p_source.size(), 0);
+        mp_parse_tree_t parse_tree = mp_parse(lex, MP_PARSE_FILE_INPUT);
+        mp_raw_code_t *raw_code = mp_compile_to_raw_code(&parse_tree, source_name, MP_EMIT_OPT_NONE, false);
+        if (!save_raw_code(raw_code, r_bytecode)) {
+            nlr_raise(mp_obj_new_exception_msg(&mp_type_ValueError, "native code cannot be saved as bytecode"));
+        }
+    };
+    auto handle_ex = [&error](mp_obj_t ex) {
+        mp_obj_print_exception(&mp_plat_print, ex);
+        error = ex;
+    };
+    MP_WRAP_CALL_EX(compile_module, handle_ex);
+    return error ? ERR_COMPILATION_FAILED : OK;
+}
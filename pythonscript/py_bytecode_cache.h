@@ -0,0 +1,45 @@
+#ifndef PYTHONSCRIPT_PY_BYTECODE_CACHE_H
+#define PYTHONSCRIPT_PY_BYTECODE_CACHE_H
+
+// Microphython
+#include "micropython/micropython.h"
+// Godot imports
+#include "core/ustring.h"
+#include "core/vector.h"
+
+
+/**
+ * Compiled modules (micropython's `.mpy` format) are stored on disk so that
+ * the next launch doesn't have to lex, parse and compile them again.
+ * Cache files (`.pyc`, not to be confused with the plain `.mpy` files produced
+ * by the export) start with a text line identifying the cache format, the
+ * interpreter version and the source's md5, a mismatch means the entry is
+ * stale and must be rebuilt.
+ * Entries are stored in `python_script/bytecode_cache/path` (`user://` by
+ * default) or next to the script (in a `__pycache__` folder) in the editor.
+ */
+class PyBytecodeCache {
+
+public:
+
+    // Identifies the source and the interpreter that compiled it
+    static String compute_key(const Vector<uint8_t> &p_source);
+    // Source as keyed and compiled, i.e. the script's decoded source (without
+    // BOM) encoded back to utf-8
+    static Vector<uint8_t> encode_source(const String &p_source);
+    static String get_cache_path(const String &p_script_path, const String &p_module_path);
+
+    // Return the cached bytecode, empty if missing or stale
+    static Vector<uint8_t> load(const String &p_cache_path, const String &p_key);
+    static Error save(const String &p_cache_path, const String &p_key, const Vector<uint8_t> &p_bytecode);
+
+    // Serialize compiled code into `r_bytecode` (.mpy format), false if it
+    // contains native code. Must be called from a micropython context
+    static bool save_raw_code(mp_raw_code_t *p_raw_code, Vector<uint8_t> *r_bytecode);
+    // Compile a module's source into bytecode (e.g. when exporting), errors
+    // are printed with `p_source_name` as filename
+    static Error compile(const Vector<uint8_t> &p_source, const String &p_source_name, Vector<uint8_t> *r_bytecode);
+};
+
+
+#endif // PYTHONSCRIPT_PY_BYTECODE_CACHE_H
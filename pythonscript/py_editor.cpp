@@ -1,9 +1,13 @@
 // Godot imports
 #include "core/globals.h"
 #include "core/os/file_access.h"
+#include "core/os/os.h"
+#include "core/os/thread.h"
 // Pythonscript imports
 #include "py_language.h"
 #include "py_script.h"
+#include "py_perf.h"
+#include "py_startup.h"
 
 
 /* EDITOR FUNCTIONS */
@@ -78,7 +82,7 @@ void PyLanguage::get_string_delimiters(List<String> *p_delimiters) const {
 Ref<Script> PyLanguage::get_template(const String& p_class_name, const String& p_base_class_name) const {
     String _template = String()+
     "from godot import exposed, export\n" +
-    "from godot.bindings import *\n" +
+    "from godot.bindings import %BASE%\n" +
     "\n\n" +
     "@exposed\n" +
     "class %CLS%(%BASE%):\n" +
@@ -223,14 +227,34 @@ void PyLanguage::get_public_constants(List<Pair<String,Variant> > *p_constants)
 
 void PyLanguage::profiling_start() {
 #ifdef DEBUG_ENABLED
-    // TODO
+    if (lock) {
+        lock->lock();
+    }
+
+    this->_profile_data.clear();
+    this->_profile_stack.clear();
+    this->profiling = true;
+    this->_update_instrument_calls();
+
+    if (lock) {
+        lock->unlock();
+    }
 #endif
 }
 
 
 void PyLanguage::profiling_stop() {
 #ifdef DEBUG_ENABLED
-    // TODO
+    if (lock) {
+        lock->lock();
+    }
+
+    this->profiling = false;
+    this->_update_instrument_calls();
+
+    if (lock) {
+        lock->unlock();
+    }
 #endif
 }
 
@@ -238,7 +262,24 @@ void PyLanguage::profiling_stop() {
 int PyLanguage::profiling_get_accumulated_data(ProfilingInfo *p_info_arr,int p_info_max) {
     int current=0;
 #ifdef DEBUG_ENABLED
-    // TODO
+    if (lock) {
+        lock->lock();
+    }
+
+    for(Map<StringName,ProfileData>::Element *E=this->_profile_data.front(); E && current < p_info_max; E=E->next()) {
+        const ProfileData &data = E->get();
+        if (data.call_count) {
+            p_info_arr[current].signature = data.signature;
+            p_info_arr[current].call_count = data.call_count;
+            p_info_arr[current].self_time = data.self_time;
+            p_info_arr[current].total_time = data.total_time;
+            current++;
+        }
+    }
+
+    if (lock) {
+        lock->unlock();
+    }
 #endif
     return current;
 }
@@ -247,14 +288,113 @@ int PyLanguage::profiling_get_accumulated_data(ProfilingInfo *p_info_arr,int p_i
 int PyLanguage::profiling_get_frame_data(ProfilingInfo *p_info_arr,int p_info_max) {
     int current=0;
 #ifdef DEBUG_ENABLED
-    // TODO
+    if (lock) {
+        lock->lock();
+    }
+
+    for(Map<StringName,ProfileData>::Element *E=this->_profile_data.front(); E && current < p_info_max; E=E->next()) {
+        const ProfileData &data = E->get();
+        if (data.last_frame_call_count) {
+            p_info_arr[current].signature = data.signature;
+            p_info_arr[current].call_count = data.last_frame_call_count;
+            p_info_arr[current].self_time = data.last_frame_self_time;
+            p_info_arr[current].total_time = data.last_frame_total_time;
+            current++;
+        }
+    }
+
+    if (lock) {
+        lock->unlock();
+    }
 #endif
     return current;
 }
 
 
+void PyLanguage::_profiling_enter(PyScript *p_script, qstr p_method) {
+    if (Thread::get_main_ID() != Thread::get_caller_ID()) {
+        return; // no support for other threads than main for now
+    }
+    // Building the signature needs the StringName table's lock, do it once
+    const StringName *cached = p_script->_profile_signatures.getptr(p_method);
+    if (!cached) {
+        p_script->_profile_signatures.set(p_method, StringName(p_script->get_path() + "::" + qstr_str(p_method)));
+        cached = p_script->_profile_signatures.getptr(p_method);
+    }
+    const StringName &signature = *cached;
+    Map<StringName,ProfileData>::Element *E = this->_profile_data.find(signature);
+    if (!E) {
+        E = this->_profile_data.insert(signature, ProfileData());
+        ProfileData &new_data = E->get();
+        new_data.signature = signature;
+        new_data.call_count = new_data.self_time = new_data.total_time = 0;
+        new_data.frame_call_count = new_data.frame_self_time = new_data.frame_total_time = 0;
+        new_data.last_frame_call_count = new_data.last_frame_self_time = new_data.last_frame_total_time = 0;
+    }
+    ProfileCall call;
+    call.data = &E->get();
+    call.children_time = 0;
+    call.start = OS::get_singleton()->get_ticks_usec();
+    this->_profile_stack.push_back(call);
+}
+
+
+void PyLanguage::_profiling_exit(bool p_record) {
+    if (Thread::get_main_ID() != Thread::get_caller_ID()) {
+        return; // no support for other threads than main for now
+    }
+    const uint64_t end = OS::get_singleton()->get_ticks_usec();
+    const int depth = this->_profile_stack.size();
+    if (depth == 0) {
+        return; // profiling has been restarted during the call
+    }
+    const ProfileCall call = this->_profile_stack[depth - 1];
+    this->_profile_stack.resize(depth - 1);
+    if (!p_record) {
+        return; // time is accounted as the caller's own
+    }
+    const uint64_t total_time = end - call.start;
+    const uint64_t self_time = total_time - call.children_time;
+    if (depth > 1) {
+        this->_profile_stack[depth - 2].children_time += total_time;
+    }
+
+    ProfileData *data = call.data;
+    data->call_count++;
+    data->self_time += self_time;
+    data->total_time += total_time;
+    data->frame_call_count++;
+    data->frame_self_time += self_time;
+    data->frame_total_time += total_time;
+}
+
+
 void PyLanguage::frame() {
+    if (PyStartupTimings::needs_report()) {
+        PyStartupTimings::report(GlobalConfig::get_singleton()->get("python_script/profiler/startup_trace_output"));
+    }
+#ifdef PYTHONSCRIPT_PERF_COUNTERS
+    PyPerf::frame();
+#endif
 #ifdef DEBUG_ENABLED
-    // TODO
+    if (this->profiling) {
+        if (lock) {
+            lock->lock();
+        }
+
+        for(Map<StringName,ProfileData>::Element *E=this->_profile_data.front(); E; E=E->next()) {
+            ProfileData &data = E->get();
+            data.last_frame_call_count = data.frame_call_count;
+            data.last_frame_self_time = data.frame_self_time;
+            data.last_frame_total_time = data.frame_total_time;
+            data.frame_call_count = 0;
+            data.frame_self_time = 0;
+            data.frame_total_time = 0;
+        }
+
+        if (lock) {
+            lock->unlock();
+        }
+    }
 #endif
 }
@@ -0,0 +1,75 @@
+#ifdef TOOLS_ENABLED
+
+// Godot imports
+#include "core/globals.h"
+#include "core/os/file_access.h"
+#include "editor/editor_file_system.h"
+// Pythonscript imports
+#include "py_export.h"
+#include "py_bytecode_cache.h"
+#include "py_import.h"
+
+
+static void _list_python_scripts(EditorFileSystemDirectory *p_dir, List<String> *r_paths) {
+    for (int i = 0; i < p_dir->get_subdir_count(); ++i) {
+        _list_python_scripts(p_dir->get_subdir(i), r_paths);
+    }
+    for (int i = 0; i < p_dir->get_file_count(); ++i) {
+        const String path = p_dir->get_file_path(i);
+        if (path.get_extension() == "py") {
+            r_paths->push_back(path);
+        }
+    }
+}
+
+
+void EditorExportPyScript::_export_begin(const Set<String> &p_features) {
+    const bool compile = GlobalConfig::get_singleton()->get("python_script/export/compile_bytecode");
+    List<String> paths;
+    _list_python_scripts(EditorFileSystem::get_singleton()->get_filesystem(), &paths);
+    // Scripts are compiled here rather than in `_export_file` so the index
+    // points at what is actually added to the pack: a script that doesn't
+    // compile (e.g. native code) is exported as source
+    this->_bytecodes.clear();
+    String index;
+    for (const List<String>::Element *E = paths.front(); E; E = E->next()) {
+        const String &path = E->get();
+        const String module = path.substr(6, path.length() - 6).get_basename().replace("/", ".");
+        String exported_path = path;
+        if (compile) {
+            Vector<uint8_t> bytecode;
+            if (PyBytecodeCache::compile(FileAccess::get_file_as_array(path), path, &bytecode) == OK) {
+                this->_bytecodes[path] = bytecode;
+                exported_path = path.get_basename() + ".mpy";
+            } else {
+                ERR_PRINTS("Cannot compile " + path + " to bytecode, exporting its source instead");
+            }
+        }
+        index += module + " " + exported_path + "\n";
+    }
+    const CharString index_utf8 = index.utf8();
+    Vector<uint8_t> data;
+    data.resize(index_utf8.length());
+    copymem(data.ptr(), index_utf8.get_data(), index_utf8.length());
+    add_file(PYTHON_MODULES_INDEX_PATH, data, false);
+}
+
+
+void EditorExportPyScript::_export_file(const String &p_path, const String &p_type, const Set<String> &p_features) {
+    if (p_path.get_extension() != "py") {
+        return;
+    }
+    const Map<String, Vector<uint8_t> >::Element *E = this->_bytecodes.find(p_path);
+    if (!E) {
+        // Not compiled, exported as is
+        return;
+    }
+    // Remapped files replace the original one in the pack
+    add_file(p_path.get_basename() + ".mpy", E->get(), true);
+    if (GlobalConfig::get_singleton()->get("python_script/export/keep_sources")) {
+        add_file(p_path, FileAccess::get_file_as_array(p_path), false);
+    }
+}
+
+
+#endif // TOOLS_ENABLED
@@ -0,0 +1,35 @@
+#ifndef PYTHONSCRIPT_PY_EXPORT_H
+#define PYTHONSCRIPT_PY_EXPORT_H
+
+#ifdef TOOLS_ENABLED
+
+// Godot imports
+#include "core/map.h"
+#include "editor/editor_export.h"
+
+
+/**
+ * Compile the project's python scripts to bytecode (`foo.py` -> `foo.mpy`,
+ * remapped so loading `foo.py` loads the bytecode) when exporting.
+ * Sources are stripped unless `python_script/export/keep_sources` is set
+ * (scripts that can't be compiled, e.g. native code, are exported as is).
+ * An index of the modules (`res://python_modules.idx`, one
+ * `<module> <path>` per line) is added to the pack as well.
+ */
+class EditorExportPyScript : public EditorExportPlugin {
+
+    GDCLASS(EditorExportPyScript, EditorExportPlugin);
+
+    // Bytecode of the scripts that compiled, per source path
+    Map<String, Vector<uint8_t> > _bytecodes;
+
+public:
+
+    virtual void _export_begin(const Set<String> &p_features);
+    virtual void _export_file(const String &p_path, const String &p_type, const Set<String> &p_features);
+};
+
+
+#endif // TOOLS_ENABLED
+
+#endif // PYTHONSCRIPT_PY_EXPORT_H
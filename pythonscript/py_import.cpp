@@ -0,0 +1,183 @@
+// Godot imports
+#include "core/os/dir_access.h"
+#include "core/os/file_access.h"
+#ifdef TOOLS_ENABLED
+#include "core/engine.h"
+#endif
+// Microphython
+#include "micropython/micropython.h"
+extern "C" {
+#include "py/reader.h"
+#include "py/mperrno.h"
+}
+// Pythonscript imports
+#include "py_import.h"
+
+
+bool PyImportIndex::_built = false;
+HashMap<String, int> PyImportIndex::_entries;
+
+
+String PyImportIndex::normalize_path(const char *p_path) {
+    String path = String::utf8(p_path);
+    if (path.find("://") == -1) {
+        // Empty `sys.path` entry, it used to mean the project's directory
+        path = "res://" + path;
+    }
+    return path.simplify_path();
+}
+
+
+bool PyImportIndex::_load_modules_index(const String &p_index_path) {
+    if (!FileAccess::exists(p_index_path)) {
+        return false;
+    }
+    const Vector<uint8_t> data = FileAccess::get_file_as_array(p_index_path);
+    String index;
+    index.parse_utf8(reinterpret_cast<const char *>(data.ptr()), data.size());
+    const Vector<String> lines = index.split("\n", false);
+    for (int i = 0; i < lines.size(); ++i) {
+        const int sep = lines[i].find(" ");
+        ERR_CONTINUE(sep == -1);
+        const String path = lines[i].substr(sep + 1, lines[i].length() - sep - 1).simplify_path();
+        _entries.set(path, MP_IMPORT_STAT_FILE);
+        // Parent directories are needed for packages
+        for (String dir = path.get_base_dir(); !_entries.has(dir); dir = dir.get_base_dir()) {
+            _entries.set(dir, MP_IMPORT_STAT_DIR);
+            if (dir == "res://") {
+                break;
+            }
+        }
+    }
+    return true;
+}
+
+
+void PyImportIndex::_scan_dir(const String &p_dir) {
+    DirAccess *dir = DirAccess::create_for_path(p_dir);
+    if (dir->change_dir(p_dir) != OK) {
+        memdelete(dir);
+        return;
+    }
+    _entries.set(p_dir, MP_IMPORT_STAT_DIR);
+    Vector<String> subdirs;
+    dir->list_dir_begin();
+    for (String name = dir->get_next(); name != ""; name = dir->get_next()) {
+        // Also skips `.` and `..`
+        if (name.begins_with(".") || name == "__pycache__") {
+            continue;
+        }
+        if (dir->current_is_dir()) {
+            subdirs.push_back(p_dir.plus_file(name));
+        } else if (name.get_extension() == "py" || name.get_extension() == "mpy") {
+            _entries.set(p_dir.plus_file(name), MP_IMPORT_STAT_FILE);
+        }
+    }
+    dir->list_dir_end();
+    memdelete(dir);
+    for (int i = 0; i < subdirs.size(); ++i) {
+        _scan_dir(subdirs[i]);
+    }
+}
+
+
+int PyImportIndex::_stat_filesystem(const String &p_path) {
+    DirAccess *dir = DirAccess::create_for_path(p_path);
+    const bool is_dir = dir->dir_exists(p_path);
+    memdelete(dir);
+    if (is_dir) {
+        return MP_IMPORT_STAT_DIR;
+    }
+    return FileAccess::exists(p_path) ? MP_IMPORT_STAT_FILE : MP_IMPORT_STAT_NO_EXIST;
+}
+
+
+void PyImportIndex::build(const Vector<String> &p_sys_path) {
+    _entries.clear();
+    const bool res_indexed = _load_modules_index(PYTHON_MODULES_INDEX_PATH);
+    for (int i = 0; i < p_sys_path.size(); ++i) {
+        const String path = normalize_path(p_sys_path[i].utf8().get_data());
+        // Already indexed as a subdirectory of a previous entry
+        if ((res_indexed && path.begins_with("res://")) || _entries.has(path)) {
+            continue;
+        }
+        _scan_dir(path);
+    }
+    _built = true;
+}
+
+
+int PyImportIndex::stat(const String &p_path) {
+    if (!_built) {
+        return _stat_filesystem(p_path);
+    }
+    const int *entry = _entries.getptr(p_path);
+    if (entry) {
+        return *entry;
+    }
+#ifdef TOOLS_ENABLED
+    // Scripts can be created while the editor is running
+    if (Engine::get_singleton()->is_editor_hint()) {
+        return _stat_filesystem(p_path);
+    }
+#endif
+    return MP_IMPORT_STAT_NO_EXIST;
+}
+
+
+void PyImportIndex::clear() {
+    _entries.clear();
+    _built = false;
+}
+
+
+/* Needed by micropython */
+
+
+// Godot objects must be destroyed before raising a python exception given
+// it longjmps over their destructors, hence the error code.
+static int _read_file(const char *p_filename, byte **r_buf, size_t *r_len) {
+    FileAccess *file = FileAccess::open(PyImportIndex::normalize_path(p_filename), FileAccess::READ);
+    if (!file) {
+        return MP_ENOENT;
+    }
+    const size_t len = file->get_len();
+    // Zero-sized allocation would return NULL
+    byte *buf = m_new_maybe(byte, len ? len : 1);
+    if (buf) {
+        file->get_buffer(buf, len);
+        *r_buf = buf;
+        *r_len = len;
+    }
+    memdelete(file);
+    return buf ? 0 : MP_ENOMEM;
+}
+
+
+extern "C" {
+
+mp_import_stat_t mp_import_stat(const char *path) {
+    return static_cast<mp_import_stat_t>(PyImportIndex::stat(PyImportIndex::normalize_path(path)));
+}
+
+
+// Used to read both .py and .mpy files
+void mp_reader_new_file(mp_reader_t *reader, const char *filename) {
+    byte *buf = NULL;
+    size_t len = 0;
+    const int err = _read_file(filename, &buf, &len);
+    if (err) {
+        nlr_raise(mp_obj_new_exception_arg1(&mp_type_OSError, MP_OBJ_NEW_SMALL_INT(err)));
+    }
+    // The reader frees the buffer once done
+    mp_reader_new_mem(reader, buf, len, len ? len : 1);
+}
+
+
+mp_lexer_t *mp_lexer_new_from_file(const char *filename) {
+    mp_reader_t reader;
+    mp_reader_new_file(&reader, filename);
+    return mp_lexer_new(qstr_from_str(filename), reader);
+}
+
+}
@@ -0,0 +1,45 @@
+#ifndef PYTHONSCRIPT_PY_IMPORT_H
+#define PYTHONSCRIPT_PY_IMPORT_H
+
+// Godot imports
+#include "core/hash_map.h"
+#include "core/ustring.h"
+#include "core/vector.h"
+
+
+// Written by the export (see py_export.h), one `<module> <path>` per line
+#define PYTHON_MODULES_INDEX_PATH "res://python_modules.idx"
+
+
+/**
+ * Python modules lookup for micropython's import machinery (i.e.
+ * `mp_import_stat` and the file reader), going through Godot's FileAccess
+ * so modules can be imported from a PCK.
+ * The python files & directories reachable from `sys.path` are indexed once
+ * at init (or read from the modules index of an exported project for
+ * `res://`), each lookup is then a hash probe instead of filesystem calls.
+ * Paths are Godot ones, relative paths (the empty `sys.path` entry) are
+ * relative to `res://`.
+ */
+class PyImportIndex {
+
+    static bool _built;
+    // Values are `mp_import_stat_t`
+    static HashMap<String, int> _entries;
+
+    static bool _load_modules_index(const String &p_index_path);
+    static void _scan_dir(const String &p_dir);
+    static int _stat_filesystem(const String &p_path);
+
+public:
+
+    static String normalize_path(const char *p_path);
+
+    static void build(const Vector<String> &p_sys_path);
+    static int stat(const String &p_path);
+    static int get_entry_count() { return _entries.size(); }
+    static void clear();
+};
+
+
+#endif // PYTHONSCRIPT_PY_IMPORT_H
@@ -4,6 +4,9 @@
 #include "py_instance.h"
 #include "bindings/binder.h"
 #include "bindings/dynamic_binder.h"
+#include "py_perf.h"
+#include "py_stats.h"
+#include "py_tier_up.h"
 
 #if 0
 class ScriptInstance {
@@ -358,9 +361,50 @@ bool PyInstance::has_method(const StringName& p_method) const {
 
 
 Variant PyInstance::call(const StringName& p_method,const Variant** p_args,int p_argcount,Variant::CallError &r_error) {
-    DEBUG_TRACE_METHOD_ARGS(" : " << String(p_method).utf8());
+    DEBUG_TRACE_METHOD_ARGS(" : " + String(p_method));
 
+    PY_PERF_COUNT(INSTANCE_CALL);
     qstr method_name = qstr_from_str(String(p_method).utf8().get_data());
+    if (PyTierUp::is_enabled()) {
+        PyTierUp::count_call(this->_script, method_name);
+    }
+    if (PyLanguage::get_singleton()->_instrument_calls) {
+        return this->_instrumented_call(method_name, p_args, p_argcount, r_error);
+    }
+    return this->_call(method_name, p_args, p_argcount, r_error);
+}
+
+
+Variant PyInstance::_instrumented_call(qstr method_name,const Variant** p_args,int p_argcount,Variant::CallError &r_error) {
+    PyLanguage *language = PyLanguage::get_singleton();
+    PySampler *sampler = language->_sampler;
+    const bool sampling = sampler->is_running() && Thread::get_main_ID() == Thread::get_caller_ID();
+    if (sampling) {
+        sampler->push(this->_script->_qstr_module_path, method_name);
+    }
+#ifdef DEBUG_ENABLED
+    const bool profiling = language->profiling;
+    if (profiling) {
+        language->_profiling_enter(this->_script, method_name);
+    }
+#endif
+
+    Variant ret = this->_call(method_name, p_args, p_argcount, r_error);
+
+#ifdef DEBUG_ENABLED
+    if (profiling) {
+        // Godot blindly calls callbacks (e.g. `_process`) that may not exist
+        language->_profiling_exit(r_error.error == Variant::CallError::CALL_OK);
+    }
+#endif
+    if (sampling) {
+        sampler->pop();
+    }
+    return ret;
+}
+
+
+Variant PyInstance::_call(qstr method_name,const Variant** p_args,int p_argcount,Variant::CallError &r_error) {
     Variant ret;
     auto call_method = [this, method_name, p_args, p_argcount, &ret]() {
         mp_obj_t method_obj = mp_load_attr(this->_mpo, method_name);
@@ -373,6 +417,7 @@ Variant PyInstance::call(const StringName& p_method,const Variant** p_args,int p
         ret = bindings->pyobj_to_variant(pyobj_ret);
     };
     auto handle_ex = [&r_error](mp_obj_t ex) {
+        PY_PERF_COUNT(EXCEPTION);
         // Godot could try to call some functions even if they don't exist
         // so don't print any exception here
         r_error.error = Variant::CallError::CALL_ERROR_INVALID_METHOD;
@@ -398,7 +443,7 @@ Variant PyInstance::call(const StringName& p_method,const Variant** p_args,int p
 
 #if 0  // TODO: Don't rely on default implementations provided by ScriptInstance ?
 void PyInstance::call_multilevel(const StringName& p_method,const Variant** p_args,int p_argcount) {
-    DEBUG_TRACE_METHOD_ARGS(" : " << String(p_method).utf8());
+    DEBUG_TRACE_METHOD_ARGS(" : " + String(p_method));
 
 #if 0
     PyScript *sptr=script.ptr();
@@ -434,7 +479,7 @@ void PyInstance::_ml_call_reversed(PyScript *sptr,const StringName& p_method,con
 
 
 void PyInstance::call_multilevel_reversed(const StringName& p_method,const Variant** p_args,int p_argcount) {
-    DEBUG_TRACE_METHOD_ARGS(" : " << String(p_method).utf8());
+    DEBUG_TRACE_METHOD_ARGS(" : " + String(p_method));
 
 #if 0
     if (script.ptr()) {
@@ -516,6 +561,7 @@ PyInstance::RPCMode PyInstance::get_rset_mode(const StringName& p_variable) cons
 
 PyInstance::PyInstance() {
     DEBUG_TRACE_METHOD();
+    PythonScriptStats::instance_created();
 }
 
 
@@ -534,7 +580,7 @@ bool PyInstance::init(PyScript *p_script, Object *p_owner) {
         // Script is not a "real" instance of the class is expend, instead it
         // takes controle of the owner
         mp_obj_instance_t *inst = static_cast<mp_obj_instance_t *>(MP_OBJ_TO_PTR(this->_mpo));
-        auto self = static_cast<DynamicBinder::mp_godot_bind_t *>(inst->subobj[0]);
+        auto self = static_cast<DynamicBinder::mp_godot_bind_t *>(MP_OBJ_TO_PTR(inst->subobj[0]));
         self->godot_obj = p_owner;
         self->godot_variant = Variant(p_owner);
         // Set owner responsible to destroy the instance
@@ -552,5 +598,5 @@ bool PyInstance::init(PyScript *p_script, Object *p_owner) {
 
 PyInstance::~PyInstance() {
     DEBUG_TRACE_METHOD();
-
+    PythonScriptStats::instance_deleted();
 }
@@ -19,6 +19,9 @@ private:
     Object *_owner;
     mp_obj_t _mpo;
 
+    Variant _call(qstr method_name,const Variant** p_args,int p_argcount,Variant::CallError &r_error);
+    Variant _instrumented_call(qstr method_name,const Variant** p_args,int p_argcount,Variant::CallError &r_error);
+
 public:
 
     _FORCE_INLINE_ Object* get_owner() { return this->_owner; }
@@ -9,6 +9,11 @@
 #include "py_language.h"
 #include "py_script.h"
 #include "bindings/dynamic_binder.h"
+#include "py_perf.h"
+#include "py_startup.h"
+#include "py_import.h"
+#include "py_bytecode_arena.h"
+#include "py_tier_up.h"
 
 
 /************* SCRIPT LANGUAGE **************/
@@ -47,11 +52,11 @@ mp_obj_t PyLanguage::get_mp_exposed_class_from_module(const qstr qstr_module_nam
 
 
 void _mp_init_sys_path_and_argv(String path) {
-    String resource_path = GlobalConfig::get_singleton()->get_resource_path();
-    String data_dir = OS::get_singleton()->get_data_dir();
-    printf("MITROPYTHON_PATH %s\n", path.utf8().get_data());
+    DEBUG_TRACE_ARGS(path);
 
     // Init sys.path list
+    // Paths are kept as Godot ones (i.e. `res://`), modules are looked up
+    // and read through FileAccess (see py_import.h)
     auto pathes = path.split(";");
     mp_uint_t path_num = pathes.size() + 1; // [0] is for current dir (or base dir of the script)
     mp_obj_t *path_items;
@@ -59,18 +64,8 @@ void _mp_init_sys_path_and_argv(String path) {
     mp_obj_list_get(mp_sys_path, &path_num, &path_items);
     path_items[0] = MP_OBJ_NEW_QSTR(MP_QSTR_);
     for (int i=0; i < pathes.size(); ++i) {
-        auto curr_path = pathes[i];
-        if (curr_path.begins_with("res://")) {
-            curr_path = curr_path.replace("res:/", resource_path);
-        }
-        else if (curr_path.begins_with("user://")) {
-            if (data_dir != "") {
-                curr_path = curr_path.replace("user:/", data_dir);
-            };
-            curr_path = curr_path.replace("user://", "");
-        }
-        printf("-> %s\n", curr_path.utf8().get_data());
-        path_items[i+1] = mp_obj_new_str(curr_path.utf8().get_data(), curr_path.length(), false);
+        const CharString curr_path = pathes[i].utf8();
+        path_items[i+1] = mp_obj_new_str(curr_path.get_data(), curr_path.length(), false);
     }
 
     // Init sys.argv
@@ -85,21 +80,67 @@ void PyLanguage::init() {
     GLOBAL_DEF("python_script/stack_size", 40 * 1024);
     GLOBAL_DEF("python_script/heap_size", 128 * 1024 * 1024);
     GLOBAL_DEF("python_script/path", "res://;res://lib");
+    GLOBAL_DEF("python_script/bytecode_cache/enabled", true);
+    GLOBAL_DEF("python_script/bytecode_cache/path", "user://__pycache__");
+    GLOBAL_DEF("python_script/export/compile_bytecode", true);
+    GLOBAL_DEF("python_script/export/keep_sources", false);
+    GLOBAL_DEF("python_script/editor/precompile_on_startup", true);
+    GLOBAL_DEF("python_script/editor/mpy_cross_path", "");
+    this->_bytecode_cache_enabled = globals->get("python_script/bytecode_cache/enabled");
+    GLOBAL_DEF("python_script/lazy_load", false);
+    this->_lazy_load = globals->get("python_script/lazy_load");
+    // Bind Godot classes on first access instead of all of them at init,
+    // `from godot.bindings import *` only gets the ones already bound then
+    GLOBAL_DEF("python_script/lazy_bindings", false);
+    GLOBAL_DEF("python_script/tier_up/enabled", false);
+    GLOBAL_DEF("python_script/tier_up/threshold", 1000);
+    PyTierUp::init(globals->get("python_script/tier_up/enabled"), globals->get("python_script/tier_up/threshold"));
+    GLOBAL_DEF("python_script/profiler/sampling_enabled", false);
+    GLOBAL_DEF("python_script/profiler/sampling_frequency", 1000);
+    GLOBAL_DEF("python_script/profiler/sampling_output", "user://python_samples.txt");
+    GLOBAL_DEF("python_script/profiler/startup_timing", false);
+    GLOBAL_DEF("python_script/profiler/startup_trace_output", "");
+    PyStartupTimings::set_enabled(globals->get("python_script/profiler/startup_timing"));
+    const uint64_t init_start = PyStartupTimings::now();
+    uint64_t phase_start;
 
     // MicroPython init
     // Initialized stack limit
     mp_stack_set_limit(globals->get("python_script/stack_size") * (BYTES_PER_WORD / 4));
     // Initialize heap
+    phase_start = PyStartupTimings::now();
     int heap_size = globals->get("python_script/heap_size");
     this->_mp_heap = static_cast<char*>(malloc(heap_size));
+#ifdef PYTHONSCRIPT_NANBOX
+    // NaN-boxed objects only have room for 48-bit pointers
+    ERR_FAIL_COND((uint64_t)(uintptr_t)(this->_mp_heap + heap_size) >> 48);
+#endif
     gc_init(this->_mp_heap, this->_mp_heap + heap_size);
     // Disable automatic garbage collection
     MP_STATE_MEM(gc_auto_collect_enabled) = 0;
+    PyStartupTimings::record("heap_init", phase_start);
     // Initialize interpreter
+    phase_start = PyStartupTimings::now();
     mp_init();
+    PyStartupTimings::record("mp_init", phase_start);
+    phase_start = PyStartupTimings::now();
     _mp_init_sys_path_and_argv(globals->get("python_script/path"));
+    PyStartupTimings::record("sys_path_init", phase_start);
+    phase_start = PyStartupTimings::now();
+    {
+        Vector<String> sys_path = String(globals->get("python_script/path")).split(";");
+        sys_path.insert(0, "");
+        PyImportIndex::build(sys_path);
+    }
+    PyStartupTimings::record("import_index", phase_start);
     // Build the bindings module and store into as part of the main godot module
-    init_bindings();
+    init_bindings(globals->get("python_script/lazy_bindings"));
+#if PYTHONSCRIPT_TRACE_LEVEL > 0
+    PyTrace::install_crash_handler();
+    {
+        MP_WRAP_CALL([]() { PyTrace::bind(GodotBindingsModule::get_singleton()->get_mp_module()); });
+    }
+#endif
     // Load godot python module and connect it to PyLanguage
     mp_obj_t error = 0;
     auto import_module = [this]() {
@@ -110,17 +151,28 @@ void PyLanguage::init() {
         // // Retrieve module's exposed class
         // this->_mpo_exposed_classes_per_module = mp_load_method(
         //     mpo_godot_module, qstr_from_str("__exposed_classes_per_module"));
-        // TODO: make the bindings creation lazy ?
         mp_obj_dict_t *mod_globals = static_cast<mp_obj_module_t *>(MP_OBJ_TO_PTR(this->_mpo_godot_module))->globals;
         auto bindings = GodotBindingsModule::get_singleton();
         mp_obj_dict_store(MP_OBJ_FROM_PTR(mod_globals), MP_OBJ_NEW_QSTR(qstr_from_str("bindings")), bindings->get_mp_module());
+        PyPerf::bind(this->_mpo_godot_module);
     };
     auto handle_ex = [&error](mp_obj_t ex) {
         mp_obj_print_exception(&mp_plat_print, ex);
         error = ex;
     };
+    phase_start = PyStartupTimings::now();
     MP_WRAP_CALL_EX(import_module, handle_ex);
+    PyStartupTimings::record("import_godot", phase_start);
     ERR_FAIL_COND(error);
+
+    // Sampling profiler is available even in release builds
+    this->_sampler = memnew(PySampler);
+    if (globals->get("python_script/profiler/sampling_enabled")) {
+        this->_sampler->start(globals->get("python_script/profiler/sampling_frequency"),
+                              globals->get("python_script/profiler/sampling_output"));
+        this->_update_instrument_calls();
+    }
+    PyStartupTimings::record("language_init", init_start);
 #if 0
     //populate global constants
     int gcc=GlobalConstants::get_global_constant_count();
@@ -181,9 +233,17 @@ Error PyLanguage::execute_file(const String& p_path)  {
 
 void PyLanguage::finish()  {
     DEBUG_TRACE_METHOD();
+    if (this->_sampler) {
+        // Dumping samples needs the qstrs, so stop before deinit
+        memdelete(this->_sampler);
+        this->_sampler = NULL;
+        this->_update_instrument_calls();
+    }
     mp_deinit();
     free(this->_mp_heap);
+    PyBytecodeArena::clear();
     GodotBindingsModule::finish();
+    PyImportIndex::clear();
 }
 
 
@@ -408,7 +468,7 @@ void PyLanguage::get_reserved_words(List<String> *p_words) const  {
 }
 
 #endif // if 0
-PyLanguage::PyLanguage() : _mpo_godot_module(mp_const_none) {
+PyLanguage::PyLanguage() : _mpo_godot_module(mp_const_none), _bytecode_cache_enabled(false), _lazy_load(false), profiling(false), _instrument_calls(false), _sampler(NULL) {
     DEBUG_TRACE_METHOD();
     ERR_FAIL_COND(this->singleton);
     this->singleton=this;
@@ -6,8 +6,12 @@
 // Godot imports
 #include "core/script_language.h"
 #include "core/self_list.h"
+#include "core/map.h"
+#include "core/vector.h"
 #include "core/io/resource_loader.h"
 #include "core/io/resource_saver.h"
+// Pythonscript imports
+#include "py_profiler.h"
 
 
 class PyScript;
@@ -23,11 +27,50 @@ class PyLanguage : public ScriptLanguage {
     SelfList<PyScript>::List script_list;
     mp_obj_t _mpo_godot_module;
     char *_mp_heap;
+    bool _bytecode_cache_enabled;
+    bool _lazy_load;
+
+    /* PROFILING */
+
+    struct ProfileData {
+        StringName signature;
+        uint64_t call_count;
+        uint64_t self_time;
+        uint64_t total_time;
+        uint64_t frame_call_count;
+        uint64_t frame_self_time;
+        uint64_t frame_total_time;
+        uint64_t last_frame_call_count;
+        uint64_t last_frame_self_time;
+        uint64_t last_frame_total_time;
+    };
+
+    // Python calls currently running, used to compute self time
+    struct ProfileCall {
+        ProfileData *data;
+        uint64_t start;
+        uint64_t children_time;
+    };
+
+    bool profiling;
+    // Set when either profiling or sampling, checked on each call
+    bool _instrument_calls;
+    PySampler *_sampler;
+    Map<StringName,ProfileData> _profile_data;
+    Vector<ProfileCall> _profile_stack;
+
+    void _profiling_enter(PyScript *p_script, qstr p_method);
+    void _profiling_exit(bool p_record);
+    _FORCE_INLINE_ void _update_instrument_calls() {
+        this->_instrument_calls = this->profiling || (this->_sampler && this->_sampler->is_running());
+    }
 
 public:
     /* CUSTOM PYTHONSCRIPT FUNCTIONS */
     mp_obj_t get_mp_exposed_class_from_module(const qstr qstr_module_name);
     _FORCE_INLINE_ mp_obj_t get_mp_exposed_class_from_module(const char *module_name) {return get_mp_exposed_class_from_module(qstr_from_str(module_name));}
+    // Scripts are only imported once used (see PyScript::warm_up)
+    _FORCE_INLINE_ bool is_lazy_load_enabled() const { return this->_lazy_load; }
 
     String get_name() const;
     _FORCE_INLINE_ static PyLanguage *get_singleton() { return singleton; }
@@ -1,25 +1,109 @@
 // Godot imports
 #include "os/file_access.h"
+#include "os/thread.h"
 // Pythonscript imports
 #include "py_loader.h"
 #include "py_script.h"
 
 
+// Micropython isn't thread safe, scripts loaded from another thread are
+// imported on first use (i.e. from the main thread)
+static void _import_script(const Ref<PyScript> &p_script)
+{
+	if (PyLanguage::get_singleton()->is_lazy_load_enabled() || Thread::get_caller_ID() != Thread::get_main_ID()) {
+		// Imported on first use, e.g. scenes referencing scripts they never instantiate
+		p_script->defer_reload();
+	} else {
+		p_script->reload();
+	}
+}
+
+static Error _read_script(const Ref<PyScript> &p_script, const String &p_path, const String& p_original_path)
+{
+	// `.mpy` files are scripts compiled at export time
+	Error err = p_path.get_extension().to_lower() == "mpy" ?
+			p_script->load_byte_code(p_path) : p_script->load_source_code(p_path);
+	ERR_FAIL_COND_V(err != OK, err);
+
+	p_script->set_path(p_original_path);
+	return OK;
+}
+
+
+ResourceInteractiveLoaderPyScript::ResourceInteractiveLoaderPyScript() : stage(STAGE_READ), error(OK)
+{
+}
+
+void ResourceInteractiveLoaderPyScript::open(const String &p_path, const String& p_original_path)
+{
+	this->path = p_path;
+	this->original_path = p_original_path;
+	this->script.instance();
+}
+
+Ref<Resource> ResourceInteractiveLoaderPyScript::get_resource()
+{
+	if (this->stage < STAGE_MAX || this->error != ERR_FILE_EOF)
+		return Ref<Resource>();
+	return this->script;
+}
+
+Error ResourceInteractiveLoaderPyScript::poll()
+{
+	if (this->error != OK)
+		return this->error;
+
+	switch (this->stage) {
+		case STAGE_READ:
+			this->error = _read_script(this->script, this->path, this->original_path);
+			break;
+		case STAGE_CACHE:
+			this->error = this->script->prefetch_bytecode_cache();
+			break;
+		case STAGE_IMPORT:
+			_import_script(this->script);
+			break;
+	}
+	this->stage++;
+	if (this->error == OK && this->stage == STAGE_MAX)
+		this->error = ERR_FILE_EOF;
+	return this->error;
+}
+
+int ResourceInteractiveLoaderPyScript::get_stage() const
+{
+	return this->stage;
+}
+
+int ResourceInteractiveLoaderPyScript::get_stage_count() const
+{
+	return STAGE_MAX;
+}
+
+
+Ref<ResourceInteractiveLoader> ResourceFormatLoaderPyScript::load_interactive(const String &p_path, const String& p_original_path, Error *r_error)
+{
+	if (r_error)
+		*r_error=OK;
+
+	Ref<ResourceInteractiveLoaderPyScript> ril;
+	ril.instance();
+	ril->open(p_path, p_original_path);
+	return ril;
+}
+
 RES ResourceFormatLoaderPyScript::load(const String &p_path, const String& p_original_path, Error *r_error)
 {
 	if (r_error)
 		*r_error=ERR_FILE_CANT_OPEN;
 
-	PyScript *script = memnew( PyScript );
+	Ref<PyScript> scriptres;
+	scriptres.instance();
 
-	Ref<PyScript> scriptres(script);
-
-	Error err = script->load_source_code(p_path);
+	Error err = _read_script(scriptres, p_path, p_original_path);
 	ERR_FAIL_COND_V(err != OK, RES());
 
-	script->set_path(p_original_path);
-
-	script->reload();
+	_import_script(scriptres);
 
 	if (r_error)
 		*r_error=OK;
@@ -30,6 +114,7 @@ RES ResourceFormatLoaderPyScript::load(const String &p_path, const String& p_ori
 void ResourceFormatLoaderPyScript::get_recognized_extensions(List<String> *p_extensions) const
 {
 	p_extensions->push_back("py");
+	p_extensions->push_back("mpy");
 }
 
 bool ResourceFormatLoaderPyScript::handles_type(const String& p_type) const
@@ -40,7 +125,7 @@ bool ResourceFormatLoaderPyScript::handles_type(const String& p_type) const
 String ResourceFormatLoaderPyScript::get_resource_type(const String &p_path) const
 {
 	String el = p_path.get_extension().to_lower();
-	if (el == "py")
+	if (el == "py" || el == "mpy")
 		return "PyScript";
 	return "";
 }
@@ -5,11 +5,47 @@
 #include "core/script_language.h"
 #include "io/resource_loader.h"
 #include "io/resource_saver.h"
+// Pythonscript imports
+#include "py_script.h"
 
 
+/**
+ * Load a script in stages: reading the file and the bytecode cache entry
+ * can be done from a loading thread, importing the module (micropython is
+ * not thread safe) is done on the main thread, or on the script's first use
+ * if the loader is polled from another thread.
+ */
+class ResourceInteractiveLoaderPyScript : public ResourceInteractiveLoader {
+
+	enum Stage {
+		STAGE_READ,
+		STAGE_CACHE,
+		STAGE_IMPORT,
+		STAGE_MAX
+	};
+
+	String path;
+	String original_path;
+	int stage;
+	Error error;
+	Ref<PyScript> script;
+
+public:
+
+	void open(const String &p_path, const String& p_original_path);
+
+	virtual Ref<Resource> get_resource();
+	virtual Error poll();
+	virtual int get_stage() const;
+	virtual int get_stage_count() const;
+
+	ResourceInteractiveLoaderPyScript();
+};
+
 class ResourceFormatLoaderPyScript : public ResourceFormatLoader {
 public:
 
+	virtual Ref<ResourceInteractiveLoader> load_interactive(const String &p_path,const String& p_original_path="",Error *r_error=NULL);
 	virtual RES load(const String &p_path,const String& p_original_path="",Error *r_error=NULL);
 	virtual void get_recognized_extensions(List<String> *p_extensions) const;
 	virtual bool handles_type(const String& p_type) const;
@@ -0,0 +1,122 @@
+#include <cstring>
+
+// Godot imports
+#include "core/os/os.h"
+// Pythonscript imports
+#include "py_perf.h"
+
+
+uint32_t PyPerf::_counters[PyPerf::COUNTER_MAX];
+uint32_t PyPerf::_to_pyobj[Variant::VARIANT_MAX];
+uint32_t PyPerf::_to_variant[Variant::VARIANT_MAX];
+uint32_t PyPerf::_last_frame_counters[PyPerf::COUNTER_MAX];
+uint32_t PyPerf::_last_frame_to_pyobj[Variant::VARIANT_MAX];
+uint32_t PyPerf::_last_frame_to_variant[Variant::VARIANT_MAX];
+
+
+static const char *_counter_names[PyPerf::COUNTER_MAX] = {
+    "instance_call",
+    "method_call",
+    "property_get",
+    "property_set",
+    "wrapper_alloc",
+    "exception",
+};
+
+
+void PyPerf::frame() {
+    memcpy(_last_frame_counters, _counters, sizeof(_counters));
+    memcpy(_last_frame_to_pyobj, _to_pyobj, sizeof(_to_pyobj));
+    memcpy(_last_frame_to_variant, _to_variant, sizeof(_to_variant));
+    memset(_counters, 0, sizeof(_counters));
+    memset(_to_pyobj, 0, sizeof(_to_pyobj));
+    memset(_to_variant, 0, sizeof(_to_variant));
+}
+
+
+void PyPerf::reset() {
+    memset(_counters, 0, sizeof(_counters));
+    memset(_to_pyobj, 0, sizeof(_to_pyobj));
+    memset(_to_variant, 0, sizeof(_to_variant));
+    memset(_last_frame_counters, 0, sizeof(_last_frame_counters));
+    memset(_last_frame_to_pyobj, 0, sizeof(_last_frame_to_pyobj));
+    memset(_last_frame_to_variant, 0, sizeof(_last_frame_to_variant));
+}
+
+
+static mp_obj_t _build_conversions_dict(const uint32_t *p_conversions) {
+    mp_obj_t dict = mp_obj_new_dict(0);
+    for (int i = 0; i < Variant::VARIANT_MAX; ++i) {
+        if (p_conversions[i]) {
+            const String type_name = Variant::get_type_name(Variant::Type(i));
+            mp_obj_dict_store(dict, MP_OBJ_NEW_QSTR(qstr_from_str(type_name.utf8().get_data())),
+                              mp_obj_new_int_from_uint(p_conversions[i]));
+        }
+    }
+    return dict;
+}
+
+
+void PyPerf::bind(mp_obj_t p_godot_module) {
+    mp_obj_t module = mp_obj_new_module(qstr_from_str("godot.perf"));
+
+#ifdef PYTHONSCRIPT_PERF_COUNTERS
+    mp_store_attr(module, qstr_from_str("enabled"), mp_const_true);
+#else
+    mp_store_attr(module, qstr_from_str("enabled"), mp_const_false);
+#endif
+
+    // get_counters(current=False) -> {name: count}
+    auto get_counters = m_new_obj(mp_obj_fun_builtin_var_t);
+    get_counters->base.type = &mp_type_fun_builtin_var;
+    get_counters->is_kw = false;
+    get_counters->n_args_min = 0;
+    get_counters->n_args_max = 1;
+    get_counters->fun.var = [](size_t n, const mp_obj_t *args) -> mp_obj_t {
+        const uint32_t *counters = (n && mp_obj_is_true(args[0])) ? _counters : _last_frame_counters;
+        mp_obj_t dict = mp_obj_new_dict(COUNTER_MAX);
+        for (int i = 0; i < COUNTER_MAX; ++i) {
+            mp_obj_dict_store(dict, MP_OBJ_NEW_QSTR(qstr_from_str(_counter_names[i])),
+                              mp_obj_new_int_from_uint(counters[i]));
+        }
+        return dict;
+    };
+    mp_store_attr(module, qstr_from_str("get_counters"), MP_OBJ_FROM_PTR(get_counters));
+
+    // get_conversions(current=False) -> {'to_python': {type: count}, 'to_godot': {type: count}}
+    auto get_conversions = m_new_obj(mp_obj_fun_builtin_var_t);
+    get_conversions->base.type = &mp_type_fun_builtin_var;
+    get_conversions->is_kw = false;
+    get_conversions->n_args_min = 0;
+    get_conversions->n_args_max = 1;
+    get_conversions->fun.var = [](size_t n, const mp_obj_t *args) -> mp_obj_t {
+        const bool current = n && mp_obj_is_true(args[0]);
+        mp_obj_t dict = mp_obj_new_dict(2);
+        mp_obj_dict_store(dict, MP_OBJ_NEW_QSTR(qstr_from_str("to_python")),
+                          _build_conversions_dict(current ? _to_pyobj : _last_frame_to_pyobj));
+        mp_obj_dict_store(dict, MP_OBJ_NEW_QSTR(qstr_from_str("to_godot")),
+                          _build_conversions_dict(current ? _to_variant : _last_frame_to_variant));
+        return dict;
+    };
+    mp_store_attr(module, qstr_from_str("get_conversions"), MP_OBJ_FROM_PTR(get_conversions));
+
+    // reset()
+    auto reset = m_new_obj(mp_obj_fun_builtin_fixed_t);
+    reset->base.type = &mp_type_fun_builtin_0;
+    reset->fun._0 = []() -> mp_obj_t {
+        PyPerf::reset();
+        return mp_const_none;
+    };
+    mp_store_attr(module, qstr_from_str("reset"), MP_OBJ_FROM_PTR(reset));
+
+    // ticks_usec() -> int, monotonic clock for benchmarks without going
+    // through the bindings
+    auto ticks_usec = m_new_obj(mp_obj_fun_builtin_fixed_t);
+    ticks_usec->base.type = &mp_type_fun_builtin_0;
+    ticks_usec->fun._0 = []() -> mp_obj_t {
+        return mp_obj_new_int_from_ull(OS::get_singleton()->get_ticks_usec());
+    };
+    mp_store_attr(module, qstr_from_str("ticks_usec"), MP_OBJ_FROM_PTR(ticks_usec));
+
+    mp_store_attr(p_godot_module, qstr_from_str("perf"), module);
+}
@@ -0,0 +1,66 @@
+#ifndef PYTHONSCRIPT_PY_PERF_H
+#define PYTHONSCRIPT_PY_PERF_H
+
+// Microphython
+#include "micropython/micropython.h"
+// Godot imports
+#include "core/variant.h"
+
+
+/**
+ * Godot <-> Python boundary counters, enabled at compile time with the
+ * `PYTHONSCRIPT_PERF_COUNTERS=yes` scons argument. Counters are rotated
+ * each frame and can be queried from python through the `godot.perf`
+ * module (which is always available, but only reports zeros when the
+ * counters have been compiled out).
+ */
+class PyPerf {
+
+public:
+
+    enum Counter {
+        INSTANCE_CALL, // Godot calling a python script method
+        METHOD_CALL, // Python calling a Godot method
+        PROPERTY_GET,
+        PROPERTY_SET,
+        WRAPPER_ALLOC, // Python wrapper created on a Godot object
+        EXCEPTION,
+        COUNTER_MAX
+    };
+
+private:
+
+    static uint32_t _counters[COUNTER_MAX];
+    static uint32_t _to_pyobj[Variant::VARIANT_MAX];
+    static uint32_t _to_variant[Variant::VARIANT_MAX];
+
+    static uint32_t _last_frame_counters[COUNTER_MAX];
+    static uint32_t _last_frame_to_pyobj[Variant::VARIANT_MAX];
+    static uint32_t _last_frame_to_variant[Variant::VARIANT_MAX];
+
+public:
+
+    _FORCE_INLINE_ static void count(Counter p_counter) { _counters[p_counter]++; }
+    _FORCE_INLINE_ static void count_to_pyobj(Variant::Type p_type) { _to_pyobj[p_type]++; }
+    _FORCE_INLINE_ static void count_to_variant(Variant::Type p_type) { _to_variant[p_type]++; }
+
+    // Make current counters the last frame's ones and start a new frame
+    static void frame();
+    static void reset();
+    // Create the `godot.perf` module and store it into `p_godot_module`
+    static void bind(mp_obj_t p_godot_module);
+};
+
+
+#ifdef PYTHONSCRIPT_PERF_COUNTERS
+#define PY_PERF_COUNT(COUNTER) PyPerf::count(PyPerf::COUNTER)
+#define PY_PERF_COUNT_TO_PYOBJ(TYPE) PyPerf::count_to_pyobj(TYPE)
+#define PY_PERF_COUNT_TO_VARIANT(TYPE) PyPerf::count_to_variant(TYPE)
+#else
+#define PY_PERF_COUNT(COUNTER)
+#define PY_PERF_COUNT_TO_PYOBJ(TYPE)
+#define PY_PERF_COUNT_TO_VARIANT(TYPE)
+#endif
+
+
+#endif // PYTHONSCRIPT_PY_PERF_H
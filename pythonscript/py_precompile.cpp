@@ -0,0 +1,156 @@
+#ifdef TOOLS_ENABLED
+
+// Godot imports
+#include "core/globals.h"
+#include "core/os/dir_access.h"
+#include "core/os/file_access.h"
+#include "core/os/os.h"
+#include "core/os/thread.h"
+// Pythonscript imports
+#include "py_precompile.h"
+#include "py_bytecode_cache.h"
+
+
+// Must match the lib's config (see MPY_CROSS_FLAGS in micropython/Makefile)
+#define MPY_CROSS_FLAGS "-mcache-lookup-bc"
+
+
+PyPrecompiler::PyPrecompiler(const String &p_mpy_cross_path) :
+        _mpy_cross_path(p_mpy_cross_path), _next_job(0), _compiled(0), _lock(Mutex::create()) {
+}
+
+
+PyPrecompiler::~PyPrecompiler() {
+    memdelete(this->_lock);
+}
+
+
+void PyPrecompiler::_list_jobs(const String &p_dir) {
+    DirAccess *dir = DirAccess::create_for_path(p_dir);
+    if (dir->change_dir(p_dir) != OK) {
+        memdelete(dir);
+        return;
+    }
+    Vector<String> subdirs;
+    dir->list_dir_begin();
+    for (String name = dir->get_next(); name != ""; name = dir->get_next()) {
+        // Also skips `.` and `..`
+        if (name.begins_with(".") || name == "__pycache__") {
+            continue;
+        }
+        if (dir->current_is_dir()) {
+            subdirs.push_back(p_dir.plus_file(name));
+        } else if (name.get_extension() == "py") {
+            Job job;
+            job.script_path = p_dir.plus_file(name);
+            job.cache_path = PyBytecodeCache::get_cache_path(job.script_path, String());
+            // Keyed like `PyScript::reload` does, from the decoded source
+            const Vector<uint8_t> data = FileAccess::get_file_as_array(job.script_path);
+            String source;
+            if (source.parse_utf8(reinterpret_cast<const char *>(data.ptr()), data.size())) {
+                // Invalid utf-8, the script won't load anyway
+                continue;
+            }
+            job.cache_key = PyBytecodeCache::compute_key(PyBytecodeCache::encode_source(source));
+            if (PyBytecodeCache::load(job.cache_path, job.cache_key).empty()) {
+                this->_jobs.push_back(job);
+            }
+        }
+    }
+    dir->list_dir_end();
+    memdelete(dir);
+    for (int i = 0; i < subdirs.size(); ++i) {
+        this->_list_jobs(subdirs[i]);
+    }
+}
+
+
+bool PyPrecompiler::_compile(const Job &p_job) {
+    auto globals = GlobalConfig::get_singleton();
+    const String output_path = p_job.cache_path + ".tmp";
+    List<String> args;
+    args.push_back("-o");
+    args.push_back(globals->globalize_path(output_path));
+    args.push_back("-s");
+    args.push_back(p_job.script_path);
+    args.push_back(MPY_CROSS_FLAGS);
+    args.push_back(globals->globalize_path(p_job.script_path));
+
+    DirAccess *dir = DirAccess::create_for_path(output_path);
+    if (!dir->dir_exists(output_path.get_base_dir())) {
+        dir->make_dir_recursive(output_path.get_base_dir());
+    }
+    int exitcode = -1;
+    String output;
+    const Error err = OS::get_singleton()->execute(this->_mpy_cross_path, args, true, NULL, &output, &exitcode);
+    bool success = false;
+    if (err == OK && exitcode == 0) {
+        const Vector<uint8_t> bytecode = FileAccess::get_file_as_array(output_path);
+        success = bytecode.size() && PyBytecodeCache::save(p_job.cache_path, p_job.cache_key, bytecode) == OK;
+    } else {
+        // Syntax error and such, they will show up when the script is loaded
+        print_line(output);
+    }
+    dir->remove(output_path);
+    memdelete(dir);
+    return success;
+}
+
+
+void PyPrecompiler::_worker(void *p_userdata) {
+    PyPrecompiler *self = static_cast<PyPrecompiler *>(p_userdata);
+    while (true) {
+        self->_lock->lock();
+        const int job = self->_next_job++;
+        self->_lock->unlock();
+        if (job >= self->_jobs.size()) {
+            return;
+        }
+        // Const access: a non-const one could trigger a copy-on-write
+        const Vector<Job> &jobs = self->_jobs;
+        if (self->_compile(jobs[job])) {
+            self->_lock->lock();
+            self->_compiled++;
+            self->_lock->unlock();
+        }
+    }
+}
+
+
+void PyPrecompiler::precompile_project() {
+    auto globals = GlobalConfig::get_singleton();
+    if (!globals->get("python_script/bytecode_cache/enabled") ||
+        !globals->get("python_script/editor/precompile_on_startup")) {
+        return;
+    }
+    String mpy_cross_path = globals->get("python_script/editor/mpy_cross_path");
+    if (mpy_cross_path == "") {
+        mpy_cross_path = OS::get_singleton()->get_executable_path().get_base_dir().plus_file("mpy-cross");
+    }
+    if (!FileAccess::exists(mpy_cross_path)) {
+        WARN_PRINTS("Cannot find mpy-cross (" + mpy_cross_path + "), python modules won't be precompiled");
+        return;
+    }
+
+    const uint64_t start = OS::get_singleton()->get_ticks_usec();
+    PyPrecompiler precompiler(mpy_cross_path);
+    precompiler._list_jobs("res://");
+    if (precompiler._jobs.empty()) {
+        return;
+    }
+    const int worker_count = MIN(OS::get_singleton()->get_processor_count(), precompiler._jobs.size());
+    Vector<Thread *> workers;
+    for (int i = 0; i < worker_count; ++i) {
+        workers.push_back(Thread::create(_worker, &precompiler));
+    }
+    for (int i = 0; i < workers.size(); ++i) {
+        Thread::wait_to_finish(workers[i]);
+        memdelete(workers[i]);
+    }
+    print_line("Python modules precompiled: " + itos(precompiler._compiled) + "/" + itos(precompiler._jobs.size()) +
+               " in " + itos((OS::get_singleton()->get_ticks_usec() - start) / 1000) + "ms (" +
+               itos(worker_count) + " workers)");
+}
+
+
+#endif // TOOLS_ENABLED
@@ -0,0 +1,52 @@
+#ifndef PYTHONSCRIPT_PY_PRECOMPILE_H
+#define PYTHONSCRIPT_PY_PRECOMPILE_H
+
+#ifdef TOOLS_ENABLED
+
+// Godot imports
+#include "core/os/mutex.h"
+#include "core/ustring.h"
+#include "core/vector.h"
+
+
+/**
+ * Fill the bytecode cache (see py_bytecode_cache.h) for all the project's
+ * python files when the editor starts, so opening scenes only has to link
+ * the already compiled modules.
+ * Micropython's compiler can't be run concurrently in the editor process,
+ * hence modules are compiled by `mpy-cross` processes (each one with its own
+ * heap), spread across as many worker threads as there are cores.
+ * Enabled with `python_script/editor/precompile_on_startup`, `mpy-cross` is
+ * looked up in `python_script/editor/mpy_cross_path` or next to the editor.
+ */
+class PyPrecompiler {
+
+    struct Job {
+        String script_path;
+        String cache_path;
+        String cache_key;
+    };
+
+    String _mpy_cross_path;
+    Vector<Job> _jobs;
+    int _next_job;
+    int _compiled;
+    Mutex *_lock;
+
+    static void _worker(void *p_userdata);
+    void _list_jobs(const String &p_dir);
+    bool _compile(const Job &p_job);
+
+public:
+
+    // Blocks until all the outdated modules are compiled
+    static void precompile_project();
+
+    PyPrecompiler(const String &p_mpy_cross_path);
+    ~PyPrecompiler();
+};
+
+
+#endif // TOOLS_ENABLED
+
+#endif // PYTHONSCRIPT_PY_PRECOMPILE_H
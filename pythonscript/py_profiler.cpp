@@ -0,0 +1,192 @@
+// Godot imports
+#include "core/os/file_access.h"
+#include "core/os/os.h"
+#include "core/print_string.h"
+// Pythonscript imports
+#include "py_profiler.h"
+
+
+PySampler *PySampler::singleton = NULL;
+
+
+static String _frame_to_string(const String& p_frame) {
+    const int separator = p_frame.find(":");
+    ERR_FAIL_COND_V(separator < 0, p_frame);
+    const qstr module = p_frame.substr(0, separator).to_int();
+    const qstr method = p_frame.substr(separator + 1, p_frame.length()).to_int();
+    return String(qstr_str(module)) + "." + String(qstr_str(method));
+}
+
+
+void PySampler::_thread_func(void *p_userdata) {
+    PySampler *self = static_cast<PySampler*>(p_userdata);
+    OS *os = OS::get_singleton();
+    uint64_t next = os->get_ticks_usec() + self->_period_usec;
+    while (self->_running.load(std::memory_order_relaxed)) {
+        const uint64_t now = os->get_ticks_usec();
+        if (now < next) {
+            os->delay_usec(next - now);
+        }
+        next += self->_period_usec;
+        self->_take_sample();
+    }
+}
+
+
+void PySampler::_take_sample() {
+    qstr frames[PY_SAMPLER_MAX_DEPTH * 2];
+    int depth = -1;
+    // Retry a few times if the main thread has pushed a frame meanwhile,
+    // then give up on this sample rather than reporting a torn stack
+    for (int attempt = 0; attempt < 3 && depth < 0; ++attempt) {
+        const uint32_t sequence = this->_sequence.load(std::memory_order_acquire);
+        if (sequence & 1) {
+            continue;
+        }
+        depth = MIN(this->_depth.load(std::memory_order_acquire), PY_SAMPLER_MAX_DEPTH);
+        for (int i = 0; i < depth; ++i) {
+            frames[i * 2] = this->_stack[i].module.load(std::memory_order_relaxed);
+            frames[i * 2 + 1] = this->_stack[i].method.load(std::memory_order_relaxed);
+        }
+        std::atomic_thread_fence(std::memory_order_acquire);
+        if (this->_sequence.load(std::memory_order_relaxed) != sequence) {
+            depth = -1;
+        }
+    }
+    if (depth < 0) {
+        return;
+    }
+
+    String key;
+    if (depth == 0) {
+        // Main thread is not running python code
+        key = "<godot>";
+    } else {
+        for (int i = 0; i < depth; ++i) {
+            if (i) {
+                key += ";";
+            }
+            key += itos(frames[i * 2]) + ":" + itos(frames[i * 2 + 1]);
+        }
+    }
+
+    this->_samples_lock->lock();
+    Map<String, uint32_t>::Element *E = this->_samples.find(key);
+    if (E) {
+        E->get()++;
+    } else {
+        this->_samples.insert(key, 1);
+    }
+    this->_total_samples++;
+    this->_samples_lock->unlock();
+}
+
+
+void PySampler::start(int p_frequency, const String& p_output) {
+    ERR_FAIL_COND(this->_running);
+    ERR_FAIL_COND(p_frequency <= 0);
+    this->_period_usec = 1000000 / p_frequency;
+    this->_output = p_output;
+    this->_samples.clear();
+    this->_total_samples = 0;
+    this->_running.store(true);
+    this->_thread = Thread::create(_thread_func, this);
+}
+
+
+void PySampler::stop() {
+    if (!this->_running.load()) {
+        return;
+    }
+    this->_running.store(false);
+    Thread::wait_to_finish(this->_thread);
+    memdelete(this->_thread);
+    this->_thread = NULL;
+    if (this->_output != "") {
+        this->dump(this->_output);
+    }
+    this->print_summary();
+}
+
+
+Error PySampler::dump(const String& p_path) {
+    Error err;
+    FileAccess *f = FileAccess::open(p_path, FileAccess::WRITE, &err);
+    ERR_FAIL_COND_V(err, err);
+
+    this->_samples_lock->lock();
+    for (Map<String, uint32_t>::Element *E = this->_samples.front(); E; E = E->next()) {
+        String line;
+        if (E->key() == "<godot>") {
+            line = E->key();
+        } else {
+            const Vector<String> frames = E->key().split(";");
+            for (int i = 0; i < frames.size(); ++i) {
+                if (i) {
+                    line += ";";
+                }
+                line += _frame_to_string(frames[i]);
+            }
+        }
+        f->store_line(line + " " + itos(E->get()));
+    }
+    this->_samples_lock->unlock();
+
+    memdelete(f);
+    return OK;
+}
+
+
+void PySampler::print_summary(int p_max_functions) {
+    // Self samples per function (i.e. the function is on top of the stack)
+    Map<String, uint32_t> per_function;
+    uint32_t python_samples = 0;
+
+    this->_samples_lock->lock();
+    const uint32_t total_samples = this->_total_samples;
+    for (Map<String, uint32_t>::Element *E = this->_samples.front(); E; E = E->next()) {
+        if (E->key() == "<godot>") {
+            continue;
+        }
+        python_samples += E->get();
+        const String leaf = _frame_to_string(E->key().get_slice(";", E->key().get_slice_count(";") - 1));
+        Map<String, uint32_t>::Element *F = per_function.find(leaf);
+        if (F) {
+            F->get() += E->get();
+        } else {
+            per_function.insert(leaf, E->get());
+        }
+    }
+    this->_samples_lock->unlock();
+
+    if (!total_samples) {
+        return;
+    }
+    print_line("Python sampler: " + itos(total_samples) + " samples, " +
+               itos(python_samples * 100 / total_samples) + "% in python");
+    // Naive selection sort, we only display a handful of functions
+    for (int i = 0; i < p_max_functions && per_function.size(); ++i) {
+        Map<String, uint32_t>::Element *best = per_function.front();
+        for (Map<String, uint32_t>::Element *E = best->next(); E; E = E->next()) {
+            if (E->get() > best->get()) {
+                best = E;
+            }
+        }
+        print_line("  " + itos(best->get()) + "\t" + best->key());
+        per_function.erase(best);
+    }
+}
+
+
+PySampler::PySampler() : _depth(0), _sequence(0), _thread(NULL), _running(false), _period_usec(1000), _total_samples(0) {
+    ERR_FAIL_COND(singleton);
+    singleton = this;
+    this->_samples_lock = Mutex::create();
+}
+
+
+PySampler::~PySampler() {
+    this->stop();
+    memdelete(this->_samples_lock);
+    singleton = NULL;
+}
@@ -0,0 +1,102 @@
+#ifndef PYTHONSCRIPT_PY_PROFILER_H
+#define PYTHONSCRIPT_PY_PROFILER_H
+
+#include <atomic>
+// Microphython
+#include "micropython/micropython.h"
+// Godot imports
+#include "core/map.h"
+#include "core/os/mutex.h"
+#include "core/os/thread.h"
+#include "core/ustring.h"
+
+
+#define PY_SAMPLER_MAX_DEPTH 64
+
+
+/**
+ * Statistical profiler: a watchdog thread periodically samples the stack
+ * of godot -> python calls (i.e. `PyInstance::call`) currently running
+ * on the main thread and builds an histogram of those stacks.
+ *
+ * The main thread only pushes and pops frames on a shadow stack, published
+ * to the watchdog thread without lock through a sequence counter: odd while
+ * a frame is being written, a sample read across a change is dropped.
+ *
+ * Unlike `PyLanguage::profiling_*`, this is available in release builds
+ * and its cost doesn't depend on the number of calls.
+ */
+class PySampler {
+
+public:
+
+    struct Frame {
+        std::atomic<qstr> module;
+        std::atomic<qstr> method;
+    };
+
+private:
+
+    static PySampler *singleton;
+
+    // Shadow stack, only written by the main thread and read by the sampler
+    Frame _stack[PY_SAMPLER_MAX_DEPTH];
+    std::atomic<int> _depth;
+    std::atomic<uint32_t> _sequence;
+
+    Thread *_thread;
+    std::atomic<bool> _running;
+    uint64_t _period_usec;
+    String _output;
+
+    // Samples per stack, stacks being stored as `module:method;...` with
+    // qstr numbers only (a qstr cannot be safely resolved outside the
+    // main thread)
+    Mutex *_samples_lock;
+    Map<String, uint32_t> _samples;
+    uint32_t _total_samples;
+
+    static void _thread_func(void *p_userdata);
+    void _take_sample();
+
+public:
+
+    _FORCE_INLINE_ static PySampler *get_singleton() { return singleton; }
+
+    // Main thread only
+    _FORCE_INLINE_ void push(qstr p_module, qstr p_method) {
+        const int depth = this->_depth.load(std::memory_order_relaxed);
+        if (depth < PY_SAMPLER_MAX_DEPTH) {
+            // The slot may be read by a sample of the previous stack
+            const uint32_t sequence = this->_sequence.load(std::memory_order_relaxed);
+            this->_sequence.store(sequence + 1, std::memory_order_relaxed);
+            std::atomic_thread_fence(std::memory_order_release);
+            Frame &frame = this->_stack[depth];
+            frame.module.store(p_module, std::memory_order_relaxed);
+            frame.method.store(p_method, std::memory_order_relaxed);
+            this->_sequence.store(sequence + 2, std::memory_order_release);
+        }
+        this->_depth.store(depth + 1, std::memory_order_release);
+    }
+
+    // Main thread only, frames below the new top are left untouched
+    _FORCE_INLINE_ void pop() {
+        const int depth = this->_depth.load(std::memory_order_relaxed);
+        if (depth > 0) {
+            this->_depth.store(depth - 1, std::memory_order_release);
+        }
+    }
+
+    _FORCE_INLINE_ bool is_running() const { return this->_running.load(std::memory_order_relaxed); }
+    void start(int p_frequency, const String& p_output);
+    void stop();
+    // Write the collected samples as collapsed stacks (flamegraph.pl input)
+    Error dump(const String& p_path);
+    void print_summary(int p_max_functions=20);
+
+    PySampler();
+    ~PySampler();
+};
+
+
+#endif // PYTHONSCRIPT_PY_PROFILER_H
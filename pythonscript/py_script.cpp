@@ -3,6 +3,9 @@
 // Pythonscript imports
 #include "py_script.h"
 #include "py_instance.h"
+#include "py_startup.h"
+#include "py_bytecode_cache.h"
+#include "py_bytecode_arena.h"
 
 
 void PyScript::_bind_methods() {
@@ -10,6 +13,8 @@ void PyScript::_bind_methods() {
     // TODO: bind class methods here
     // ClassDB::bind_native_method(METHOD_FLAGS_DEFAULT, "new", &PyScript::_new, MethodInfo(Variant::OBJECT, "new"));
     // ClassDB::bind_method(_MD("get_as_byte_code"), &PyScript::get_as_byte_code);
+    ClassDB::bind_method(_MD("warm_up"), &PyScript::warm_up);
+    ClassDB::bind_method(_MD("is_reload_pending"), &PyScript::is_reload_pending);
 }
 
 
@@ -25,6 +30,7 @@ void PyScript::_placeholder_erased(PlaceHolderScriptInstance *p_placeholder) {
 
 
 bool PyScript::can_instance() const {
+    this->_ensure_loaded();
     DEBUG_TRACE_METHOD_ARGS((this->valid && this->_mpo_exposed_class != mp_const_none ? " true" : " false"));
     // TODO: think about it...
     // Only script file defining an exposed class can be instanciated
@@ -57,6 +63,7 @@ StringName PyScript::get_instance_base_type() const {
 // TODO: rename p_this "p_owner" ?
 ScriptInstance* PyScript::instance_create(Object *p_this) {
     DEBUG_TRACE_METHOD();
+    this->_ensure_loaded();
     if (!this->tool && !ScriptServer::is_scripting_enabled()) {
 #ifdef TOOLS_ENABLED
         //instance a fake script for editing the values
@@ -128,6 +135,8 @@ void PyScript::set_source_code(const String& p_code) {
     if (this->source == p_code)
         return;
     this->source = p_code;
+    this->_prefetched_cache_key = String();
+    this->_prefetched_bytecode = Vector<uint8_t>();
 // #ifdef TOOLS_ENABLED
 //     source_changed_cache = true;
 //     //print_line("SC CHANGED "+get_path());
@@ -136,17 +145,107 @@ void PyScript::set_source_code(const String& p_code) {
 
 
 static const String _to_mp_module_path(const String &p_path) {
-    ERR_EXPLAIN("Bad python script path, must starts by `res://` and ends with `.py`");
-    ERR_FAIL_COND_V(!p_path.begins_with("res://") || !p_path.ends_with(".py"), String());
-    return p_path.substr(6, p_path.length() - 6 - 3).replace("/", ".");
+    ERR_EXPLAIN("Bad python script path, must starts by `res://` and ends with `.py` (or `.mpy` once exported)");
+    ERR_FAIL_COND_V(!p_path.begins_with("res://") || !(p_path.ends_with(".py") || p_path.ends_with(".mpy")), String());
+    return p_path.substr(6, p_path.length() - 6).get_basename().replace("/", ".");
+}
+
+
+// Load the module's raw code from the cached bytecode, NULL if it is not
+// compatible (i.e. micropython has been built with a different config)
+static mp_raw_code_t *_load_raw_code(const Vector<uint8_t> &p_bytecode) {
+    mp_raw_code_t *raw_code = NULL;
+    nlr_buf_t nlr;
+    if (nlr_push(&nlr) == 0) {
+        raw_code = mp_raw_code_load_mem(p_bytecode.ptr(), p_bytecode.size());
+        nlr_pop();
+    }
+    return raw_code;
+}
+
+
+// Lex, parse, compile and execute the module from the source buffer, recording
+// each phase (`mp_import_name` doesn't allow that). Compilation is skipped if
+// `p_cached_bytecode` is provided, if `r_bytecode` is provided it gets the
+// module compiled to bytecode. Exported projects may only have the bytecode
+// (`p_has_source` is false). Must be called from a micropython context
+// (with nlr_push set).
+static mp_obj_t _load_module(qstr p_module_name, qstr p_source_name, bool p_has_source, const Vector<uint8_t> &p_buffer,
+                             const Vector<uint8_t> &p_cached_bytecode, Vector<uint8_t> *r_bytecode,
+                             const String &p_timing_name) {
+    uint64_t phase_start;
+    mp_raw_code_t *raw_code = NULL;
+    if (p_cached_bytecode.size()) {
+        phase_start = PyStartupTimings::now();
+        raw_code = _load_raw_code(p_cached_bytecode);
+        PyStartupTimings::record("cache_load", p_timing_name, phase_start);
+    }
+
+    if (!raw_code && !p_has_source) {
+        nlr_raise(mp_obj_new_exception_msg(&mp_type_ImportError,
+            "Incompatible bytecode (compiled by a different version), project must be exported again"));
+    }
+    if (!raw_code) {
+        phase_start = PyStartupTimings::now();
+        const char *src = p_buffer.size() ? reinterpret_cast<const char *>(p_buffer.ptr()) : "";
+        mp_lexer_t *lex = mp_lexer_new_from_str_len(p_source_name, src, p_buffer.size(), 0);
+        PyStartupTimings::record("lex", p_timing_name, phase_start);
+
+        // MicroPython's lexer is pulled by the parser, hence lexing past the
+        // first tokens is accounted in the parse phase
+        phase_start = PyStartupTimings::now();
+        mp_parse_tree_t parse_tree = mp_parse(lex, MP_PARSE_FILE_INPUT);
+        PyStartupTimings::record("parse", p_timing_name, phase_start);
+
+        phase_start = PyStartupTimings::now();
+        raw_code = mp_compile_to_raw_code(&parse_tree, p_source_name, MP_EMIT_OPT_NONE, false);
+        PyStartupTimings::record("compile", p_timing_name, phase_start);
+
+        // Modules with native functions are compiled again on each load
+        if (r_bytecode) {
+            PyBytecodeCache::save_raw_code(raw_code, r_bytecode);
+        }
+    }
+    // Bytecode doesn't need to be in the GC heap once loaded (and saved to the cache)
+    PyBytecodeArena::relocate(raw_code);
+
+    // Register the module first as `import` does (allowing circular imports)
+    phase_start = PyStartupTimings::now();
+    mp_obj_t module = mp_obj_new_module(p_module_name);
+    mp_obj_dict_t *module_globals = mp_obj_module_get_globals(module);
+    mp_obj_dict_store(MP_OBJ_FROM_PTR(module_globals), MP_OBJ_NEW_QSTR(MP_QSTR___file__), MP_OBJ_NEW_QSTR(p_source_name));
+    mp_obj_dict_t *volatile old_globals = mp_globals_get();
+    mp_obj_dict_t *volatile old_locals = mp_locals_get();
+    mp_globals_set(module_globals);
+    mp_locals_set(module_globals);
+    nlr_buf_t nlr;
+    if (nlr_push(&nlr) == 0) {
+        // The function captures the current globals, hence module's ones must
+        // be set before creating it
+        mp_obj_t module_fun = mp_make_function_from_raw_code(raw_code, MP_OBJ_NULL, MP_OBJ_NULL);
+        mp_call_function_0(module_fun);
+        nlr_pop();
+        mp_globals_set(old_globals);
+        mp_locals_set(old_locals);
+    } else {
+        mp_globals_set(old_globals);
+        mp_locals_set(old_locals);
+        // Don't keep a half-initialized module, next reload will retry
+        mp_obj_dict_delete(MP_OBJ_FROM_PTR(&MP_STATE_VM(mp_loaded_modules_dict)), MP_OBJ_NEW_QSTR(p_module_name));
+        nlr_jump(nlr.ret_val);
+    }
+    PyStartupTimings::record("execute", p_timing_name, phase_start);
+    return module;
 }
 
 
 Error PyScript::reload(bool p_keep_state) {
     DEBUG_TRACE_METHOD();
     ERR_FAIL_COND_V(!p_keep_state && this->_instances.size(), ERR_ALREADY_IN_USE);
+    this->_reload_pending = false;
 
     this->valid = false;
+    this->_run_source = String();
     String basedir = this->path;
 
     if (basedir=="")
@@ -159,28 +258,88 @@ Error PyScript::reload(bool p_keep_state) {
     const String mp_module_path = _to_mp_module_path(this->path);
     ERR_FAIL_COND_V(!mp_module_path.length(), ERR_FILE_BAD_PATH);
 
-    // Load the module into micropython
-    // TODO: mp_execute_expr should return error with traceback ?
-    // const mp_obj_t ret = mp_execute_expr((String("import ") + mp_module_path).ascii().get_data());
-    // ERR_FAIL_COND_V(ret != mp_const_none, ERR_FILE_UNRECOGNIZED);
-
     mp_obj_t error = 0;
     qstr qstr_module_path = qstr_from_str(mp_module_path.ascii().get_data());
-    auto import_module = [this, &qstr_module_path]() {
-        // TODO handle deep path for module (e.g. `import foo.bar`)
-        this->_mpo_module = mp_import_name(qstr_module_path, mp_const_none, MP_OBJ_NEW_SMALL_INT(0));
+    this->_qstr_module_path = qstr_module_path;
+    mp_map_elem_t *loaded = mp_map_lookup(&MP_STATE_VM(mp_loaded_modules_dict).map,
+                                          MP_OBJ_NEW_QSTR(qstr_module_path), MP_MAP_LOOKUP);
+    if (loaded && loaded->value == this->_mpo_module) {
+        // Reloaded by the editor, run the module again with the current source
+        mp_map_lookup(&MP_STATE_VM(mp_loaded_modules_dict).map,
+                      MP_OBJ_NEW_QSTR(qstr_module_path), MP_MAP_LOOKUP_REMOVE_IF_FOUND);
+        loaded = NULL;
+    }
+    if (loaded) {
+        // Already imported (e.g. by another python module), don't execute it twice
+        this->_mpo_module = loaded->value;
         mp_store_global(qstr_module_path, this->_mpo_module);
         this->valid = true;
-    };
-    auto handle_ex = [&error](mp_obj_t ex) {
-        mp_obj_print_exception(&mp_plat_print, ex);
-        error = ex;
-    };
-    MP_WRAP_CALL_EX(import_module, handle_ex);
+    } else {
+        // Compile from the source the loader (or the editor) has set instead
+        // of reading the file again. Done out of the micropython context: Godot
+        // objects must not be allocated where an exception could longjmp over
+        // their destructor
+        const uint64_t import_start = PyStartupTimings::now();
+        const bool has_source = this->_bytecode.empty();
+        Vector<uint8_t> buffer;
+        if (has_source) {
+            buffer = PyBytecodeCache::encode_source(this->source);
+        }
+        const qstr qstr_source_name = qstr_from_str(this->path.utf8().get_data());
+
+        // Exported bytecode doesn't need to be cached
+        const bool use_cache = has_source && PyLanguage::get_singleton()->_bytecode_cache_enabled;
+        String cache_key;
+        String cache_path;
+        Vector<uint8_t> cached_bytecode = this->_bytecode;
+        Vector<uint8_t> bytecode;
+        if (use_cache) {
+            cache_path = PyBytecodeCache::get_cache_path(this->path, mp_module_path);
+            if (this->_prefetched_cache_key.empty()) {
+                const uint64_t phase_start = PyStartupTimings::now();
+                cache_key = PyBytecodeCache::compute_key(buffer);
+                cached_bytecode = PyBytecodeCache::load(cache_path, cache_key);
+                PyStartupTimings::record("cache_read", mp_module_path, phase_start);
+            } else {
+                // Already read by the interactive loader
+                cache_key = this->_prefetched_cache_key;
+                cached_bytecode = this->_prefetched_bytecode;
+            }
+        }
+        this->_prefetched_cache_key = String();
+        this->_prefetched_bytecode = Vector<uint8_t>();
+
+        auto import_module = [this, &qstr_module_path, &qstr_source_name, has_source, &buffer,
+                              &cached_bytecode, &bytecode, use_cache, &mp_module_path]() {
+            this->_mpo_module = _load_module(qstr_module_path, qstr_source_name, has_source, buffer,
+                                             cached_bytecode, use_cache ? &bytecode : NULL, mp_module_path);
+            mp_store_global(qstr_module_path, this->_mpo_module);
+            this->valid = true;
+        };
+        auto handle_ex = [&error](mp_obj_t ex) {
+            mp_obj_print_exception(&mp_plat_print, ex);
+            error = ex;
+        };
+        MP_WRAP_CALL_EX(import_module, handle_ex);
+        if (has_source && !error) {
+            this->_run_source = this->source;
+        }
+        if (bytecode.size()) {
+            // Cache miss (or stale entry), the module has been compiled
+            const uint64_t phase_start = PyStartupTimings::now();
+            if (PyBytecodeCache::save(cache_path, cache_key, bytecode) != OK) {
+                WARN_PRINTS("Cannot write bytecode cache " + cache_path);
+            }
+            PyStartupTimings::record("cache_write", mp_module_path, phase_start);
+        }
+        PyStartupTimings::record("import", mp_module_path, import_start);
+    }
     ERR_FAIL_COND_V(error, ERR_COMPILATION_FAILED);
 
     // Retrieve module's exposed class or set it to `mp_const_none` if not available
     this->_mpo_exposed_class = PyLanguage::get_singleton()->get_mp_exposed_class_from_module(qstr_module_path);
+    this->_call_counts.clear();
+    this->_profile_signatures.clear();
 
     // mp_execute_as_module(this->sources)
     // TODO: load the module and retrieve exposed class here
@@ -245,6 +404,7 @@ struct _PyScriptMemberSort {
 
 void PyScript::get_script_method_list(List<MethodInfo> *p_list) const {
     DEBUG_TRACE_METHOD();
+    this->_ensure_loaded();
     // TODO
     return;
 
@@ -266,6 +426,7 @@ void PyScript::get_script_method_list(List<MethodInfo> *p_list) const {
 
 void PyScript::get_script_property_list(List<PropertyInfo> *p_list) const {
     DEBUG_TRACE_METHOD();
+    this->_ensure_loaded();
     // TODO
     return;
 
@@ -305,6 +466,7 @@ void PyScript::get_script_property_list(List<PropertyInfo> *p_list) const {
 
 bool PyScript::has_method(const StringName& p_method) const {
     DEBUG_TRACE_METHOD();
+    this->_ensure_loaded();
     // TODO !
     return false;
     // return member_functions.has(p_method);
@@ -313,6 +475,7 @@ bool PyScript::has_method(const StringName& p_method) const {
 
 MethodInfo PyScript::get_method_info(const StringName& p_method) const {
     DEBUG_TRACE_METHOD();
+    this->_ensure_loaded();
     // TODO !
     return MethodInfo();
     // const Map<StringName,GDFunction*>::Element *E=member_functions.find(p_method);
@@ -336,6 +499,7 @@ MethodInfo PyScript::get_method_info(const StringName& p_method) const {
 
 bool PyScript::get_property_default_value(const StringName& p_property, Variant &r_value) const {
     DEBUG_TRACE_METHOD();
+    this->_ensure_loaded();
     // TODO
 // #ifdef TOOLS_ENABLED
 
@@ -697,8 +861,36 @@ Error PyScript::load_byte_code(const String& p_path) {
 #endif // if 0
 
 
+Error PyScript::prefetch_bytecode_cache() {
+    DEBUG_TRACE_METHOD();
+    // Exported bytecode doesn't need to be cached
+    if (!this->_bytecode.empty() || !PyLanguage::get_singleton()->_bytecode_cache_enabled) {
+        return OK;
+    }
+    const String mp_module_path = _to_mp_module_path(this->path);
+    ERR_FAIL_COND_V(!mp_module_path.length(), ERR_FILE_BAD_PATH);
+    // Startup timings are not recorded given this can run in any thread
+    const String cache_key = PyBytecodeCache::compute_key(PyBytecodeCache::encode_source(this->source));
+    const String cache_path = PyBytecodeCache::get_cache_path(this->path, mp_module_path);
+    this->_prefetched_bytecode = PyBytecodeCache::load(cache_path, cache_key);
+    // Nothing to reuse on cache miss, `reload` will compile the module anyway
+    this->_prefetched_cache_key = this->_prefetched_bytecode.empty() ? String() : cache_key;
+    return OK;
+}
+
+
+Error PyScript::warm_up() {
+    DEBUG_TRACE_METHOD();
+    if (this->_reload_pending) {
+        return this->reload(true);
+    }
+    return this->valid ? OK : ERR_COMPILATION_FAILED;
+}
+
+
 Error PyScript::load_source_code(const String& p_path) {
 
+    const uint64_t read_start = PyStartupTimings::now();
     PoolVector<uint8_t> sourcef;
     Error err;
     FileAccess *f=FileAccess::open(p_path,FileAccess::READ,&err);
@@ -729,11 +921,24 @@ Error PyScript::load_source_code(const String& p_path) {
 #endif
     //print_line("LSC :"+get_path());
     this->path=p_path;
+    if (PyStartupTimings::is_enabled()) {
+        PyStartupTimings::record("read", _to_mp_module_path(p_path), read_start);
+    }
     return OK;
 
 }
 
 
+Error PyScript::load_byte_code(const String& p_path) {
+    // Compiled by the export plugin, see py_export.h
+    this->_bytecode = FileAccess::get_file_as_array(p_path);
+    ERR_FAIL_COND_V(this->_bytecode.empty(), ERR_CANT_OPEN);
+    this->source = String();
+    this->path = p_path;
+    return OK;
+}
+
+
 #if 0
 const Map<StringName,GDFunction*>& PyScript::debug_get_member_functions() const {
 
@@ -764,6 +969,7 @@ Ref<PyScript> PyScript::get_base() const {
 
 bool PyScript::has_script_signal(const StringName& p_signal) const {
     DEBUG_TRACE_METHOD();
+    this->_ensure_loaded();
     // TODO
 //     if (_signals.has(p_signal))
 //         return true;
@@ -782,6 +988,7 @@ bool PyScript::has_script_signal(const StringName& p_signal) const {
 
 void PyScript::get_script_signal_list(List<MethodInfo> *r_signals) const {
     DEBUG_TRACE_METHOD();
+    this->_ensure_loaded();
     // TODO
     return;
 
@@ -810,7 +1017,7 @@ void PyScript::get_script_signal_list(List<MethodInfo> *r_signals) const {
 }
 
 
-PyScript::PyScript() : tool(false), valid(false), _mpo_exposed_class(mp_const_none), _mpo_module(mp_const_none) {
+PyScript::PyScript() : tool(false), valid(false), _reload_pending(false), _mpo_exposed_class(mp_const_none), _mpo_module(mp_const_none), _qstr_module_path(MP_QSTR_) {
     DEBUG_TRACE_METHOD();
 
     // _mp_exposed_mp_class = NULL;
@@ -1,19 +1,14 @@
 #ifndef PYTHONSCRIPT_PY_SCRIPT_H
 #define PYTHONSCRIPT_PY_SCRIPT_H
 
-#include <iostream>
 // Microphython
 #include "micropython/micropython.h"
 // Godot imports
 #include "core/script_language.h"
+#include "core/hash_map.h"
 // Pythonscript imports
 #include "py_language.h"
-
-
-#define DEBUG_TRACE_ARGS(...) (std::cout << __FILE__ << ":" << __LINE__ << ":" << __func__ << ":" << __VA_ARGS__ << "\n")
-#define DEBUG_TRACE_METHOD() (std::cout << __FILE__ << ":" << __LINE__ << ":" << __func__ << "\t(" << (long)this << ")\n")
-#define DEBUG_TRACE_METHOD_ARGS(...) (std::cout << __FILE__ << ":" << __LINE__ << ":" << __func__ << __VA_ARGS__ << "\t(" << (long)this << ")\n")
-#define DEBUG_TRACE() (std::cout << __FILE__ << ":" << __LINE__ << ":" << __func__ << "\n")
+#include "py_trace.h"
 
 
 class PyInstance;
@@ -31,11 +26,14 @@ class PyScript : public Script {
 
 friend class PyInstance;
 friend class PyLanguage;
+friend class PyTierUp;
 
 private:
 
     bool tool;
     bool valid;
+    // Lazy load: the module is imported on first use
+    bool _reload_pending;
 
     struct MemberInfo {
         int index;
@@ -47,6 +45,21 @@ private:
 
     mp_obj_t _mpo_exposed_class;
     mp_obj_t _mpo_module;
+    qstr _qstr_module_path;
+    // Calls per method coming from Godot (see py_tier_up.h)
+    HashMap<qstr, int> _call_counts;
+    // `<path>::<method>` per method for the profiler (see PyLanguage::_profiling_enter)
+    HashMap<qstr, StringName> _profile_signatures;
+    // Source the module has been run from, empty if it has been imported
+    // by python or loaded from bytecode (see py_tier_up.h)
+    String _run_source;
+
+    // Metadata queries are const but need the module
+    _FORCE_INLINE_ void _ensure_loaded() const {
+        if (this->_reload_pending) {
+            const_cast<PyScript *>(this)->reload(true);
+        }
+    }
 
     // Ref<PyNativeClass> native;
     Ref<PyScript> base;
@@ -57,6 +70,11 @@ private:
     Set<Object*> _instances;
     //exported members
     String source;
+    // Set instead of source when loading an exported project
+    Vector<uint8_t> _bytecode;
+    // Bytecode cache entry read ahead of `reload` (see `prefetch_bytecode_cache`)
+    String _prefetched_cache_key;
+    Vector<uint8_t> _prefetched_bytecode;
     String path;
     String name;
 
@@ -87,7 +105,15 @@ public:
     String get_source_code() const;
     void set_source_code(const String& p_code);
     Error reload(bool p_keep_state=false);
+    _FORCE_INLINE_ void defer_reload() { this->_reload_pending = true; }
+    _FORCE_INLINE_ bool is_reload_pending() const { return this->_reload_pending; }
+    // Import the module now (e.g. from a loading screen) when lazy loading
+    Error warm_up();
     Error load_source_code(const String& p_path);
+    Error load_byte_code(const String& p_path);
+    // Godot side of the loading only (no micropython involved), hence can be
+    // run out of the main thread before the actual `reload`
+    Error prefetch_bytecode_cache();
 
     bool has_method(const StringName& p_method) const;
     MethodInfo get_method_info(const StringName& p_method) const;
@@ -0,0 +1,137 @@
+#include <stdio.h>
+#include <cstring>
+
+// Godot imports
+#include "core/os/file_access.h"
+#include "core/map.h"
+#include "core/sort.h"
+// Pythonscript imports
+#include "py_startup.h"
+
+
+bool PyStartupTimings::_enabled = false;
+bool PyStartupTimings::_reported = false;
+Vector<PyStartupTimings::Phase> PyStartupTimings::_phases;
+
+
+// Per-module phases, in the order they happen during a script load
+// (the enclosing "import" phase only shows up in the trace)
+static const char *_module_phases[] = {"read", "lex", "parse", "compile", "execute"};
+static const int _module_phases_count = sizeof(_module_phases) / sizeof(_module_phases[0]);
+
+
+void PyStartupTimings::record(const char *p_name, const String &p_module, uint64_t p_start) {
+    if (!_enabled) {
+        return;
+    }
+    Phase phase;
+    phase.name = p_name;
+    phase.module = p_module;
+    phase.start = p_start;
+    phase.duration = OS::get_singleton()->get_ticks_usec() - p_start;
+    _phases.push_back(phase);
+}
+
+
+struct _ModuleTimings {
+    String module;
+    uint64_t phases[_module_phases_count];
+    uint64_t total;
+
+    _FORCE_INLINE_ bool operator<(const _ModuleTimings &p_other) const { return total > p_other.total; }
+};
+
+
+void PyStartupTimings::_print_summary() {
+    printf("Python startup timings (ms):\n");
+    Map<String, int> modules_index;
+    Vector<_ModuleTimings> modules;
+    for (int i = 0; i < _phases.size(); ++i) {
+        const Phase &phase = _phases[i];
+        if (phase.module.empty()) {
+            printf("  %-24s %10.3f\n", phase.name, phase.duration / 1000.0);
+            continue;
+        }
+        if (!modules_index.has(phase.module)) {
+            _ModuleTimings timings;
+            timings.module = phase.module;
+            memset(timings.phases, 0, sizeof(timings.phases));
+            timings.total = 0;
+            modules_index[phase.module] = modules.size();
+            modules.push_back(timings);
+        }
+        _ModuleTimings &timings = modules[modules_index[phase.module]];
+        for (int j = 0; j < _module_phases_count; ++j) {
+            if (!strcmp(phase.name, _module_phases[j])) {
+                timings.phases[j] += phase.duration;
+                timings.total += phase.duration;
+            }
+        }
+    }
+    if (modules.empty()) {
+        return;
+    }
+    modules.sort();
+    uint64_t totals[_module_phases_count] = {0};
+    uint64_t total = 0;
+    printf("  %-40s", "module");
+    for (int j = 0; j < _module_phases_count; ++j) {
+        printf(" %10s", _module_phases[j]);
+    }
+    printf(" %10s\n", "total");
+    for (int i = 0; i < modules.size(); ++i) {
+        const _ModuleTimings &timings = modules[i];
+        printf("  %-40s", timings.module.utf8().get_data());
+        for (int j = 0; j < _module_phases_count; ++j) {
+            printf(" %10.3f", timings.phases[j] / 1000.0);
+            totals[j] += timings.phases[j];
+        }
+        printf(" %10.3f\n", timings.total / 1000.0);
+        total += timings.total;
+    }
+    printf("  %-40s", "<all modules>");
+    for (int j = 0; j < _module_phases_count; ++j) {
+        printf(" %10.3f", totals[j] / 1000.0);
+    }
+    printf(" %10.3f\n", total / 1000.0);
+}
+
+
+Error PyStartupTimings::_write_chrome_trace(const String &p_path) {
+    Error err;
+    FileAccess *file = FileAccess::open(p_path, FileAccess::WRITE, &err);
+    ERR_FAIL_COND_V(err, err);
+    file->store_string("{\"traceEvents\":[\n");
+    for (int i = 0; i < _phases.size(); ++i) {
+        const Phase &phase = _phases[i];
+        // Complete events ("X"), nesting is deduced from the timestamps
+        const String name = phase.module.empty() ? String(phase.name) : phase.module + ":" + phase.name;
+        String event = "{\"name\":\"" + name.json_escape() + "\",\"cat\":\"" +
+                       (phase.module.empty() ? "interpreter" : "module") + "\",\"ph\":\"X\",\"pid\":0,\"tid\":0,\"ts\":" + itos(phase.start) +
+                       ",\"dur\":" + itos(phase.duration) + "}";
+        file->store_string(event + (i + 1 < _phases.size() ? ",\n" : "\n"));
+    }
+    file->store_string("]}\n");
+    file->close();
+    memdelete(file);
+    return OK;
+}
+
+
+void PyStartupTimings::report(const String &p_trace_output) {
+    if (!_enabled || _reported) {
+        return;
+    }
+    _reported = true;
+    _print_summary();
+    if (!p_trace_output.empty()) {
+        if (_write_chrome_trace(p_trace_output) == OK) {
+            printf("Python startup trace written to %s\n", p_trace_output.utf8().get_data());
+        }
+    }
+}
+
+
+void PyStartupTimings::clear() {
+    _phases.clear();
+}
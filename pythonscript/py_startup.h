@@ -0,0 +1,58 @@
+#ifndef PYTHONSCRIPT_PY_STARTUP_H
+#define PYTHONSCRIPT_PY_STARTUP_H
+
+// Godot imports
+#include "core/os/os.h"
+#include "core/ustring.h"
+#include "core/vector.h"
+
+
+/**
+ * Timestamps of the startup phases (interpreter init, bindings, `godot`
+ * module import) and of each script's module loading (read, lex, parse,
+ * compile, execute).
+ * Enabled with the `python_script/profiler/startup_timing` setting, a
+ * summary is printed on the first frame and a Chrome trace (to open with
+ * chrome://tracing) is written if `startup_trace_output` is set.
+ *
+ * Don't use RAII helpers to record phases from micropython code: a raised
+ * exception would longjmp over their destructor.
+ */
+class PyStartupTimings {
+
+public:
+
+    struct Phase {
+        const char *name;
+        String module; // Empty for interpreter-wide phases
+        uint64_t start; // usec
+        uint64_t duration; // usec
+    };
+
+private:
+
+    static bool _enabled;
+    static bool _reported;
+    static Vector<Phase> _phases;
+
+    static void _print_summary();
+    static Error _write_chrome_trace(const String &p_path);
+
+public:
+
+    static void set_enabled(bool p_enabled) { _enabled = p_enabled; }
+    _FORCE_INLINE_ static bool is_enabled() { return _enabled; }
+
+    // Start timestamp to pass to `record`, 0 if disabled
+    _FORCE_INLINE_ static uint64_t now() { return _enabled ? OS::get_singleton()->get_ticks_usec() : 0; }
+    _FORCE_INLINE_ static void record(const char *p_name, uint64_t p_start) { record(p_name, String(), p_start); }
+    static void record(const char *p_name, const String &p_module, uint64_t p_start);
+
+    _FORCE_INLINE_ static bool needs_report() { return _enabled && !_reported; }
+    // Only does something the first time it is called (i.e. first frame)
+    static void report(const String &p_trace_output);
+    static void clear();
+};
+
+
+#endif // PYTHONSCRIPT_PY_STARTUP_H
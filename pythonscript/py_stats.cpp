@@ -0,0 +1,200 @@
+// Godot imports
+#include "core/map.h"
+#include "core/set.h"
+// Microphython
+#include "micropython/micropython.h"
+// Pythonscript imports
+#include "py_stats.h"
+#include "py_bytecode_arena.h"
+#include "py_tier_up.h"
+#include "bindings/binder.h"
+#include "bindings/dynamic_binder.h"
+
+
+PythonScriptStats *PythonScriptStats::singleton = NULL;
+uint32_t PythonScriptStats::_instance_count = 0;
+
+
+// Allocation table layout, see micropython's py/gc.c
+#define _GC_BLOCKS_PER_ATB (4)
+#define _GC_AT_HEAD (1)
+#define _GC_BYTES_PER_BLOCK (MICROPY_BYTES_PER_GC_BLOCK)
+
+static _FORCE_INLINE_ int _gc_block_kind(size_t p_block) {
+    const byte atb = MP_STATE_MEM(gc_alloc_table_start)[p_block / _GC_BLOCKS_PER_ATB];
+    return (atb >> (2 * (p_block & (_GC_BLOCKS_PER_ATB - 1)))) & 3;
+}
+
+
+static _FORCE_INLINE_ size_t _gc_blocks_count() {
+    const size_t pool_blocks = (MP_STATE_MEM(gc_pool_end) - MP_STATE_MEM(gc_pool_start)) / _GC_BYTES_PER_BLOCK;
+    const size_t atb_blocks = MP_STATE_MEM(gc_alloc_table_byte_len) * _GC_BLOCKS_PER_ATB;
+    return pool_blocks < atb_blocks ? pool_blocks : atb_blocks;
+}
+
+
+static bool _is_heap_head(const void *p_ptr) {
+    const byte *ptr = static_cast<const byte *>(p_ptr);
+    if (ptr < MP_STATE_MEM(gc_pool_start) || ptr >= MP_STATE_MEM(gc_pool_end) ||
+            (ptr - MP_STATE_MEM(gc_pool_start)) % _GC_BYTES_PER_BLOCK) {
+        return false;
+    }
+    return _gc_block_kind((ptr - MP_STATE_MEM(gc_pool_start)) / _GC_BYTES_PER_BLOCK) == _GC_AT_HEAD;
+}
+
+
+// Types not allocated in the heap, an allocation's first word can only be
+// dereferenced if it's one of those or a class living in the heap
+static void _get_static_types(Set<const mp_obj_type_t *> *r_types) {
+    static const mp_obj_type_t *core_types[] = {
+        &mp_type_type, &mp_type_object, &mp_type_str, &mp_type_bytes,
+        &mp_type_bytearray, &mp_type_int, &mp_type_float, &mp_type_tuple,
+        &mp_type_list, &mp_type_dict, &mp_type_set, &mp_type_frozenset,
+        &mp_type_fun_bc, &mp_type_fun_builtin_var, &mp_type_closure,
+        &mp_type_bound_meth, &mp_type_module, &mp_type_cell,
+        &mp_type_gen_instance, &mp_type_array, &mp_type_memoryview,
+        &mp_type_property,
+    };
+    for (unsigned int i = 0; i < sizeof(core_types) / sizeof(core_types[0]); ++i) {
+        r_types->insert(core_types[i]);
+    }
+    const List<BaseBinder *> &binders = GodotBindingsModule::get_singleton()->get_binders();
+    for (const List<BaseBinder *>::Element *E = binders.front(); E; E = E->next()) {
+        r_types->insert(E->get()->get_mp_type());
+    }
+}
+
+
+// Type of the allocation at `p_ptr`, NULL if it's not a python object
+static const mp_obj_type_t *_get_alloc_type(const void *p_ptr, const Set<const mp_obj_type_t *> &p_static_types) {
+    const mp_obj_type_t *type = static_cast<const mp_obj_base_t *>(p_ptr)->type;
+    if (p_static_types.has(type)) {
+        return type;
+    }
+    // Python classes are allocated in the heap
+    if (_is_heap_head(type) && type->base.type == &mp_type_type) {
+        return type;
+    }
+    return NULL;
+}
+
+
+// Call `p_visit(type)` on every `p_sample_rate`th allocation of the heap
+template <typename F>
+static void _walk_heap(int p_sample_rate, F p_visit) {
+    Set<const mp_obj_type_t *> static_types;
+    _get_static_types(&static_types);
+    const size_t blocks = _gc_blocks_count();
+    uint32_t heads = 0;
+    for (size_t block = 0; block < blocks; ++block) {
+        if (_gc_block_kind(block) != _GC_AT_HEAD || (heads++ % p_sample_rate)) {
+            continue;
+        }
+        const byte *ptr = MP_STATE_MEM(gc_pool_start) + block * _GC_BYTES_PER_BLOCK;
+        p_visit(_get_alloc_type(ptr, static_types));
+    }
+}
+
+
+Dictionary PythonScriptStats::get_heap_info() const {
+    gc_info_t info;
+    gc_info(&info);
+    Dictionary ret;
+    ret["total"] = (int)info.total;
+    ret["used"] = (int)info.used;
+    ret["free"] = (int)info.free;
+    ret["largest_free"] = (int)(info.max_free * _GC_BYTES_PER_BLOCK);
+    return ret;
+}
+
+
+int PythonScriptStats::get_bytecode_size() const {
+    return PyBytecodeArena::get_size();
+}
+
+
+bool PythonScriptStats::is_tier_up_enabled() const {
+    return PyTierUp::is_enabled();
+}
+
+
+int PythonScriptStats::get_native_method_count() const {
+    return PyTierUp::get_native_method_count();
+}
+
+
+int PythonScriptStats::get_gc_count() const {
+    return mp_gc_stats.collections;
+}
+
+
+int PythonScriptStats::get_gc_last_pause_usec() const {
+    return mp_gc_stats.last_pause_usec;
+}
+
+
+int PythonScriptStats::get_gc_total_pause_usec() const {
+    return mp_gc_stats.total_pause_usec;
+}
+
+
+Dictionary PythonScriptStats::get_object_counts(int p_sample_rate) const {
+    ERR_FAIL_COND_V(p_sample_rate < 1, Dictionary());
+    Map<const mp_obj_type_t *, int> counts;
+    int data_count = 0;
+    _walk_heap(p_sample_rate, [&counts, &data_count](const mp_obj_type_t *type) {
+        if (type) {
+            counts[type] += 1;
+        } else {
+            data_count++;
+        }
+    });
+    Dictionary ret;
+    for (Map<const mp_obj_type_t *, int>::Element *E = counts.front(); E; E = E->next()) {
+        const String name = qstr_str(E->key()->name);
+        // Different classes can share a name, merge them
+        ret[name] = int(ret.has(name) ? ret[name] : Variant(0)) + E->get() * p_sample_rate;
+    }
+    ret["<data>"] = data_count * p_sample_rate;
+    return ret;
+}
+
+
+int PythonScriptStats::get_wrapper_count() const {
+    int count = 0;
+    _walk_heap(1, [&count](const mp_obj_type_t *type) {
+        if (type && DynamicBinder::is_dynamic_type(type)) {
+            count++;
+        }
+    });
+    return count;
+}
+
+
+int PythonScriptStats::get_instance_count() const {
+    return _instance_count;
+}
+
+
+void PythonScriptStats::_bind_methods() {
+    ClassDB::bind_method(_MD("get_heap_info"), &PythonScriptStats::get_heap_info);
+    ClassDB::bind_method(_MD("get_bytecode_size"), &PythonScriptStats::get_bytecode_size);
+    ClassDB::bind_method(_MD("is_tier_up_enabled"), &PythonScriptStats::is_tier_up_enabled);
+    ClassDB::bind_method(_MD("get_native_method_count"), &PythonScriptStats::get_native_method_count);
+    ClassDB::bind_method(_MD("get_gc_count"), &PythonScriptStats::get_gc_count);
+    ClassDB::bind_method(_MD("get_gc_last_pause_usec"), &PythonScriptStats::get_gc_last_pause_usec);
+    ClassDB::bind_method(_MD("get_gc_total_pause_usec"), &PythonScriptStats::get_gc_total_pause_usec);
+    ClassDB::bind_method(_MD("get_object_counts", "sample_rate"), &PythonScriptStats::get_object_counts, DEFVAL(1));
+    ClassDB::bind_method(_MD("get_wrapper_count"), &PythonScriptStats::get_wrapper_count);
+    ClassDB::bind_method(_MD("get_instance_count"), &PythonScriptStats::get_instance_count);
+}
+
+
+PythonScriptStats::PythonScriptStats() {
+    singleton = this;
+}
+
+
+PythonScriptStats::~PythonScriptStats() {
+    singleton = NULL;
+}
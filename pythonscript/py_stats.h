@@ -0,0 +1,59 @@
+#ifndef PYTHONSCRIPT_PY_STATS_H
+#define PYTHONSCRIPT_PY_STATS_H
+
+// Godot imports
+#include "core/object.h"
+#include "core/dictionary.h"
+
+
+/**
+ * Runtime statistics on the python interpreter (heap, GC, objects), registered
+ * as the `PythonScriptStats` global singleton so it can be queried from
+ * GDScript as well as from python (`godot.bindings.PythonScriptStats`).
+ */
+class PythonScriptStats : public Object {
+    GDCLASS(PythonScriptStats, Object);
+
+    static PythonScriptStats *singleton;
+    static uint32_t _instance_count;
+
+protected:
+    static void _bind_methods();
+
+public:
+    _FORCE_INLINE_ static PythonScriptStats *get_singleton() { return singleton; }
+
+    // Called by PyInstance's constructor/destructor
+    _FORCE_INLINE_ static void instance_created() { _instance_count++; }
+    _FORCE_INLINE_ static void instance_deleted() { _instance_count--; }
+
+    // Heap usage in bytes: total, used, free and largest_free (biggest
+    // allocation that can be done without collecting)
+    Dictionary get_heap_info() const;
+    // Scripts' bytecode stored out of the heap (see py_bytecode_arena.h)
+    int get_bytecode_size() const;
+    // Methods compiled to native code after getting hot (see py_tier_up.h),
+    // tier-up is disabled without a native emitter
+    bool is_tier_up_enabled() const;
+    int get_native_method_count() const;
+
+    // Collections done since startup, pauses in microseconds
+    int get_gc_count() const;
+    int get_gc_last_pause_usec() const;
+    int get_gc_total_pause_usec() const;
+
+    // Walk the heap and count the objects per type name, only inspecting
+    // one allocation every `p_sample_rate` (counts are scaled accordingly).
+    // Allocations that are not python objects (strings and containers
+    // data...) are counted under `<data>`.
+    Dictionary get_object_counts(int p_sample_rate=1) const;
+    // Python wrappers on Godot objects alive in the heap (walks the heap)
+    int get_wrapper_count() const;
+    int get_instance_count() const;
+
+    PythonScriptStats();
+    ~PythonScriptStats();
+};
+
+
+#endif // PYTHONSCRIPT_PY_STATS_H
@@ -0,0 +1,196 @@
+// Godot imports
+#include "core/os/os.h"
+#include "core/script_language.h"
+// Microphython
+extern "C" {
+#include "py/bc.h"
+#include "py/objfun.h"
+}
+// Pythonscript imports
+#include "py_tier_up.h"
+#include "py_script.h"
+
+
+bool PyTierUp::_enabled = false;
+int PyTierUp::_threshold = 0;
+int PyTierUp::_native_method_count = 0;
+
+
+void PyTierUp::init(bool p_enabled, int p_threshold) {
+#if MICROPY_EMIT_NATIVE
+    _enabled = p_enabled && p_threshold > 0;
+#else
+    if (p_enabled) {
+        WARN_PRINT("No native emitter on this platform, python_script/tier_up is disabled");
+    }
+    _enabled = false;
+#endif
+    _threshold = p_threshold;
+}
+
+
+// Default arguments would be evaluated again by the recompiled method
+static bool _has_default_args(mp_obj_t p_fun) {
+    const byte *ip = static_cast<mp_obj_fun_bc_t *>(MP_OBJ_TO_PTR(p_fun))->bytecode;
+    mp_decode_uint(&ip); // n_state
+    mp_decode_uint(&ip); // n_exc_stack
+    const byte scope_flags = *ip++;
+    ip += 2; // n_pos_args & n_kwonly_args
+    const byte n_def_pos_args = *ip;
+    return n_def_pos_args || (scope_flags & MP_SCOPE_FLAG_DEFKWARGS);
+}
+
+
+// Retrieve the source of `def <p_method>(` from the body of `class <p_class>`
+// dedented and decorated with `@micropython.native`, preceded by blank lines
+// so line numbers match the script's
+static bool _extract_method_source(const String &p_source, const String &p_class, const String &p_method, String *r_source) {
+    const Vector<String> lines = p_source.split("\n");
+    int class_indent = -1;
+    int body_indent = -1;
+    int method_indent = -1;
+    int start = -1;
+    int end = lines.size();
+    String previous;
+    for (int i = 0; i < lines.size(); ++i) {
+        const String stripped = lines[i].strip_edges(true, false);
+        if (stripped.empty() || stripped.begins_with("#")) {
+            continue;
+        }
+        const int indent = lines[i].length() - stripped.length();
+        if (start >= 0) {
+            if (indent <= method_indent) {
+                end = i;
+                break;
+            }
+            continue;
+        }
+        if (class_indent >= 0 && indent <= class_indent) {
+            class_indent = -1;
+        }
+        if (class_indent < 0) {
+            if (stripped.begins_with("class " + p_class + "(") || stripped.begins_with("class " + p_class + ":")) {
+                class_indent = indent;
+                body_indent = -1;
+            }
+        } else {
+            if (body_indent < 0) {
+                body_indent = indent;
+            }
+            if (indent == body_indent && stripped.begins_with("def " + p_method + "(")) {
+                if (previous.begins_with("@")) {
+                    // The decorator would be lost
+                    return false;
+                }
+                method_indent = indent;
+                start = i;
+            }
+        }
+        previous = stripped;
+    }
+    if (start < 1) {
+        return false;
+    }
+
+    String source;
+    for (int i = 0; i < start - 1; ++i) {
+        source += "\n";
+    }
+    source += "@micropython.native\n";
+    for (int i = start; i < end; ++i) {
+        source += lines[i].substr(MIN(method_indent, lines[i].length()), lines[i].length()) + "\n";
+    }
+    // Zero-argument `super()` needs the class' `__class__` cell
+    if (source.find("super()") >= 0) {
+        return false;
+    }
+    *r_source = source;
+    return true;
+}
+
+
+bool PyTierUp::_compile_method(PyScript *p_script, qstr p_method) {
+    const mp_obj_t exposed_class = p_script->get_mpo_exposed_class();
+    // The source may have been edited since the module has run, the method
+    // must not be replaced by a different one
+    if (exposed_class == mp_const_none || p_script->_run_source.empty() ||
+            p_script->_run_source != p_script->get_source_code()) {
+        return false;
+    }
+    mp_obj_type_t *type = static_cast<mp_obj_type_t *>(MP_OBJ_TO_PTR(exposed_class));
+    // Only plain methods defined by the class itself
+    mp_map_elem_t *elem = mp_map_lookup(&type->locals_dict->map, MP_OBJ_NEW_QSTR(p_method), MP_MAP_LOOKUP);
+    if (!elem || !MP_OBJ_IS_TYPE(elem->value, &mp_type_fun_bc) || _has_default_args(elem->value)) {
+        return false;
+    }
+    String source;
+    if (!_extract_method_source(p_script->_run_source, qstr_str(type->name), qstr_str(p_method), &source)) {
+        return false;
+    }
+    const CharString utf8 = source.utf8();
+    const String path = p_script->get_path();
+    const CharString utf8_path = path.utf8();
+
+    mp_obj_t error = 0;
+    auto compile_method = [&utf8, &utf8_path, p_script, exposed_class, p_method]() {
+        const qstr source_name = qstr_from_str(utf8_path.get_data());
+        mp_lexer_t *lex = mp_lexer_new_from_str_len(source_name, utf8.get_data(), utf8.length(), 0);
+        mp_parse_tree_t parse_tree = mp_parse(lex, MP_PARSE_FILE_INPUT);
+        mp_raw_code_t *raw_code = mp_compile_to_raw_code(&parse_tree, source_name, MP_EMIT_OPT_NONE, false);
+
+        // The method sees the module's globals, but `def` must not store it there
+        mp_obj_dict_t *module_globals = mp_obj_module_get_globals(p_script->get_mpo_module());
+        mp_obj_t defined = mp_obj_new_dict(1);
+        mp_obj_dict_t *volatile old_globals = mp_globals_get();
+        mp_obj_dict_t *volatile old_locals = mp_locals_get();
+        mp_globals_set(module_globals);
+        mp_locals_set(static_cast<mp_obj_dict_t *>(MP_OBJ_TO_PTR(defined)));
+        nlr_buf_t nlr;
+        if (nlr_push(&nlr) == 0) {
+            mp_call_function_0(mp_make_function_from_raw_code(raw_code, MP_OBJ_NULL, MP_OBJ_NULL));
+            nlr_pop();
+            mp_globals_set(old_globals);
+            mp_locals_set(old_locals);
+        } else {
+            mp_globals_set(old_globals);
+            mp_locals_set(old_locals);
+            nlr_jump(nlr.ret_val);
+        }
+
+        // Instances look the method up on each call, storing it is enough
+        mp_store_attr(exposed_class, p_method, mp_obj_dict_get(defined, MP_OBJ_NEW_QSTR(p_method)));
+    };
+    auto handle_ex = [&error](mp_obj_t ex) {
+        error = ex;
+    };
+    MP_WRAP_CALL_EX(compile_method, handle_ex);
+    if (error) {
+        // Not an error: the method keeps running bytecode
+        if (OS::get_singleton()->is_stdout_verbose()) {
+            print_line(path + ": " + qstr_str(p_method) + "() stays in bytecode");
+            mp_obj_print_exception(&mp_plat_print, error);
+        }
+        return false;
+    }
+    return true;
+}
+
+
+void PyTierUp::count_call(PyScript *p_script, qstr p_method) {
+    if (ScriptDebugger::get_singleton()) {
+        return;
+    }
+    int *count = p_script->_call_counts.getptr(p_method);
+    if (!count) {
+        p_script->_call_counts.set(p_method, 1);
+        return;
+    }
+    // Negative once the method has been compiled (or can't be)
+    if (*count < 0 || ++(*count) < _threshold) {
+        return;
+    }
+    *count = -1;
+    if (_compile_method(p_script, p_method)) {
+        _native_method_count++;
+    }
+}
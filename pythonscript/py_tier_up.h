@@ -0,0 +1,45 @@
+#ifndef PYTHONSCRIPT_PY_TIER_UP_H
+#define PYTHONSCRIPT_PY_TIER_UP_H
+
+// Microphython
+#include "micropython/micropython.h"
+// Godot imports
+#include "core/typedefs.h"
+
+
+class PyScript;
+
+
+/**
+ * Automatic compilation of hot script methods to native code, as if they
+ * were decorated with `@micropython.native`.
+ * Calls coming from Godot (`PyInstance::call`) are counted per script and
+ * method, once a method reaches `python_script/tier_up/threshold` calls its
+ * source is compiled again with the native emitter and replaces the bytecode
+ * function in the exposed class.
+ * Methods stay in bytecode if the native emitter can't compile them, if
+ * they can't be recompiled in isolation (decorators, default arguments,
+ * zero-argument `super()`), if the script's source has changed since its
+ * module has run or if a debugger is attached (native code has no line
+ * information for breakpoints).
+ */
+class PyTierUp {
+
+    static bool _enabled;
+    static int _threshold;
+    static int _native_method_count;
+
+    static bool _compile_method(PyScript *p_script, qstr p_method);
+
+public:
+
+    static void init(bool p_enabled, int p_threshold);
+    _FORCE_INLINE_ static bool is_enabled() { return _enabled; }
+    // Count a call to `p_method`, compiling it if it just became hot
+    static void count_call(PyScript *p_script, qstr p_method);
+    // Methods running native code since startup
+    _FORCE_INLINE_ static int get_native_method_count() { return _native_method_count; }
+};
+
+
+#endif // PYTHONSCRIPT_PY_TIER_UP_H
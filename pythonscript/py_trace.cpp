@@ -0,0 +1,147 @@
+// Pythonscript imports
+#include "py_trace.h"
+
+#if PYTHONSCRIPT_TRACE_LEVEL > 0
+
+#include <atomic>
+#include <cstring>
+#include <stdio.h>
+#include <stdint.h>
+#include <signal.h>
+#include <unistd.h>
+#include <fcntl.h>
+// Godot imports
+#include "core/os/os.h"
+
+
+PyTrace::Record PyTrace::_ring[PY_TRACE_RING_SIZE];
+// Total number of records ever written, the ring's head is `_count % size`
+static std::atomic<uint32_t> _count(0);
+
+
+void PyTrace::record(const char *p_file, int p_line, const char *p_func, const void *p_self, const String& p_message) {
+    const uint32_t index = _count.fetch_add(1, std::memory_order_relaxed) % PY_TRACE_RING_SIZE;
+    Record &r = _ring[index];
+    r.timestamp = OS::get_singleton() ? OS::get_singleton()->get_ticks_usec() : 0;
+    r.file = p_file;
+    r.line = p_line;
+    r.func = p_func;
+    r.self = p_self;
+    if (p_message.empty()) {
+        r.message[0] = '\0';
+    } else {
+        strncpy(r.message, p_message.utf8().get_data(), PY_TRACE_MESSAGE_SIZE - 1);
+        r.message[PY_TRACE_MESSAGE_SIZE - 1] = '\0';
+    }
+#if PYTHONSCRIPT_TRACE_LEVEL > 1
+    printf("%s:%i:%s%s\t(%p)\n", r.file, r.line, r.func, r.message, r.self);
+#endif
+}
+
+
+// Formatting helpers for `dump`, printf family is not async-signal-safe
+struct _DumpBuffer {
+    char data[512];
+    int len;
+
+    _DumpBuffer() : len(0) {}
+
+    void append(const char *p_str) {
+        while (p_str && *p_str && len < (int)sizeof(data)) {
+            data[len++] = *p_str++;
+        }
+    }
+
+    void append_number(uint64_t p_value, unsigned p_base) {
+        char digits[24];
+        int n = 0;
+        do {
+            digits[n++] = "0123456789abcdef"[p_value % p_base];
+            p_value /= p_base;
+        } while (p_value);
+        while (n && len < (int)sizeof(data)) {
+            data[len++] = digits[--n];
+        }
+    }
+};
+
+
+void PyTrace::dump(int p_fd) {
+    const uint32_t count = _count.load();
+    const uint32_t n = count < PY_TRACE_RING_SIZE ? count : PY_TRACE_RING_SIZE;
+    for (uint32_t i = count - n; i != count; ++i) {
+        const Record &r = _ring[i % PY_TRACE_RING_SIZE];
+        _DumpBuffer buff;
+        buff.append("[");
+        buff.append_number(r.timestamp, 10);
+        buff.append("] ");
+        buff.append(r.file);
+        buff.append(":");
+        buff.append_number(r.line, 10);
+        buff.append(":");
+        buff.append(r.func);
+        buff.append(r.message);
+        buff.append("\t(0x");
+        buff.append_number((uintptr_t)r.self, 16);
+        buff.append(")\n");
+        if (write(p_fd, buff.data, buff.len) < 0) {
+            return;
+        }
+    }
+}
+
+
+Error PyTrace::dump(const String& p_path) {
+    const int fd = open(p_path.utf8().get_data(), O_WRONLY | O_CREAT | O_TRUNC, 0644);
+    ERR_FAIL_COND_V(fd < 0, ERR_FILE_CANT_OPEN);
+    dump(fd);
+    close(fd);
+    return OK;
+}
+
+
+static const int _crash_signals[] = { SIGSEGV, SIGABRT, SIGFPE, SIGILL, SIGBUS };
+#define _CRASH_SIGNALS_COUNT (int)(sizeof(_crash_signals) / sizeof(_crash_signals[0]))
+// Handlers in place before ours (e.g. Godot's CrashHandler)
+static struct sigaction _previous_actions[_CRASH_SIGNALS_COUNT];
+
+
+static void _crash_handler(int p_signal) {
+    const char header[] = "\n*** Pythonscript crashed, last traces: ***\n";
+    if (write(STDERR_FILENO, header, sizeof(header) - 1) >= 0) {
+        PyTrace::dump(STDERR_FILENO);
+    }
+    // Give the signal back to the previous handler, it is delivered once
+    // we return given it is blocked while we run
+    for (int i = 0; i < _CRASH_SIGNALS_COUNT; ++i) {
+        sigaction(_crash_signals[i], &_previous_actions[i], NULL);
+    }
+    raise(p_signal);
+}
+
+
+void PyTrace::install_crash_handler() {
+    struct sigaction action;
+    memset(&action, 0, sizeof(action));
+    action.sa_handler = _crash_handler;
+    sigemptyset(&action.sa_mask);
+    for (int i = 0; i < _CRASH_SIGNALS_COUNT; ++i) {
+        sigaction(_crash_signals[i], &action, &_previous_actions[i]);
+    }
+}
+
+
+void PyTrace::bind(mp_obj_t p_module) {
+    auto o = m_new_obj(mp_obj_fun_builtin_fixed_t);
+    o->base.type = &mp_type_fun_builtin_1;
+    o->fun._1 = [](mp_obj_t pypath) -> mp_obj_t {
+        if (PyTrace::dump(String(mp_obj_str_get_str(pypath))) != OK) {
+            mp_raise_msg(&mp_type_OSError, "Cannot write trace dump");
+        }
+        return mp_const_none;
+    };
+    mp_store_attr(p_module, qstr_from_str("trace_dump"), MP_OBJ_FROM_PTR(o));
+}
+
+
+#endif // PYTHONSCRIPT_TRACE_LEVEL > 0
@@ -0,0 +1,71 @@
+#ifndef PYTHONSCRIPT_PY_TRACE_H
+#define PYTHONSCRIPT_PY_TRACE_H
+
+// Microphython
+#include "micropython/micropython.h"
+// Godot imports
+#include "core/ustring.h"
+
+
+/**
+ * Tracing level, set at compile time (see `PYTHONSCRIPT_TRACE_LEVEL` in SCsub):
+ * 0: traces expand to nothing (default)
+ * 1: traces are stored with a timestamp into an in-memory ring buffer
+ *    that can be dumped on demand or when crashing
+ * 2: same as 1, but traces are also printed to stdout
+ */
+#ifndef PYTHONSCRIPT_TRACE_LEVEL
+#define PYTHONSCRIPT_TRACE_LEVEL 0
+#endif
+
+
+#if PYTHONSCRIPT_TRACE_LEVEL > 0
+
+#define PY_TRACE_RING_SIZE 4096
+#define PY_TRACE_MESSAGE_SIZE 64
+
+
+class PyTrace {
+
+    struct Record {
+        uint64_t timestamp;
+        const char *file;
+        const char *func;
+        int line;
+        const void *self;
+        char message[PY_TRACE_MESSAGE_SIZE];
+    };
+
+    static Record _ring[PY_TRACE_RING_SIZE];
+
+public:
+
+    static void record(const char *p_file, int p_line, const char *p_func, const void *p_self, const String& p_message=String());
+    // Write the content of the ring buffer to `p_fd`, oldest record first.
+    // Only relies on write(2) so it can be called from a signal handler.
+    static void dump(int p_fd);
+    static Error dump(const String& p_path);
+    // Dump the traces on fatal signals, then hand them over to the handlers
+    // previously installed
+    static void install_crash_handler();
+    // Store `trace_dump(path)` into the given python module
+    static void bind(mp_obj_t p_module);
+};
+
+
+#define DEBUG_TRACE_ARGS(...) PyTrace::record(__FILE__, __LINE__, __func__, NULL, String(__VA_ARGS__))
+#define DEBUG_TRACE_METHOD() PyTrace::record(__FILE__, __LINE__, __func__, this)
+#define DEBUG_TRACE_METHOD_ARGS(...) PyTrace::record(__FILE__, __LINE__, __func__, this, String(__VA_ARGS__))
+#define DEBUG_TRACE() PyTrace::record(__FILE__, __LINE__, __func__, NULL)
+
+#else
+
+#define DEBUG_TRACE_ARGS(...)
+#define DEBUG_TRACE_METHOD()
+#define DEBUG_TRACE_METHOD_ARGS(...)
+#define DEBUG_TRACE()
+
+#endif // PYTHONSCRIPT_TRACE_LEVEL > 0
+
+
+#endif // PYTHONSCRIPT_PY_TRACE_H
@@ -1,17 +1,41 @@
+// Godot imports
+#include "core/globals.h"
 // Pythonscript imports
 #include "py_language.h"
 #include "py_script.h"
 #include "py_loader.h"
+#include "py_stats.h"
+#ifdef TOOLS_ENABLED
+#include "editor/editor_node.h"
+#include "py_export.h"
+#include "py_precompile.h"
+#endif
 
 
 PyLanguage *script_language_py = NULL;
 ResourceFormatLoaderPyScript *resource_loader_py = NULL;
 ResourceFormatSaverPyScript *resource_saver_py = NULL;
+PythonScriptStats *python_script_stats = NULL;
+
+
+#ifdef TOOLS_ENABLED
+static void _editor_init() {
+    PyPrecompiler::precompile_project();
+
+    Ref<EditorExportPyScript> py_export;
+    py_export.instance();
+    EditorExport::get_singleton()->add_export_plugin(py_export);
+}
+#endif
 
 
 void register_pythonscript_types() {
 
     ClassDB::register_class<PyScript>();
+    ClassDB::register_class<PythonScriptStats>();
+
+    python_script_stats = memnew(PythonScriptStats);
+    GlobalConfig::get_singleton()->add_singleton(GlobalConfig::Singleton("PythonScriptStats", python_script_stats));
 
     script_language_py = memnew(PyLanguage);
     ScriptServer::register_language(script_language_py);
@@ -20,6 +44,11 @@ void register_pythonscript_types() {
     ResourceLoader::add_resource_format_loader(resource_loader_py);
     resource_saver_py = memnew(ResourceFormatSaverPyScript);
     ResourceSaver::add_resource_format_saver(resource_saver_py);
+
+#ifdef TOOLS_ENABLED
+    ClassDB::register_class<EditorExportPyScript>();
+    EditorNode::add_init_callback(_editor_init);
+#endif
 }
 
 
@@ -32,4 +61,6 @@ void unregister_pythonscript_types() {
         memdelete(resource_loader_py);
     if (resource_saver_py)
         memdelete(resource_saver_py);
+    if (python_script_stats)
+        memdelete(python_script_stats);
 }
@@ -0,0 +1,83 @@
+"""
+Helpers shared by the benchmarks: timing, percentiles and JSON report.
+"""
+import ujson
+
+from godot import perf
+
+
+def percentile(sorted_samples, p):
+    if not sorted_samples:
+        return 0
+    index = int(round(p / 100 * (len(sorted_samples) - 1)))
+    return sorted_samples[index]
+
+
+def summarize(samples):
+    samples = sorted(samples)
+    count = len(samples)
+    return {
+        'count': count,
+        'min': samples[0] if count else 0,
+        'mean': sum(samples) / count if count else 0,
+        'p50': percentile(samples, 50),
+        'p90': percentile(samples, 90),
+        'p99': percentile(samples, 99),
+        'max': samples[-1] if count else 0,
+    }
+
+
+def time_batches(fn, batches, batch_size):
+    """
+    Call `fn(batch_size)` `batches` times, return the cost per iteration
+    of each batch in nanoseconds.
+    """
+    samples = []
+    for _ in range(batches):
+        start = perf.ticks_usec()
+        fn(batch_size)
+        elapsed = perf.ticks_usec() - start
+        samples.append(elapsed * 1000 / batch_size)
+    return samples
+
+
+def write_json(path, data):
+    with open(path, 'w') as fd:
+        fd.write(ujson.dumps(data))
+    print('Benchmark results written to %s' % path)
+
+
+class Report:
+
+    def __init__(self, name, unit):
+        self.name = name
+        self.unit = unit
+        self.samples = {}
+        self.errors = {}
+
+    def add_sample(self, bench, value):
+        self.samples.setdefault(bench, []).append(value)
+
+    def add_samples(self, bench, values):
+        self.samples.setdefault(bench, []).extend(values)
+
+    def add_error(self, bench, exc):
+        self.errors[bench] = '%s: %s' % (type(exc).__name__, exc)
+
+    def to_dict(self):
+        return {
+            'suite': self.name,
+            'unit': self.unit,
+            'perf_counters': perf.enabled,
+            'results': {k: summarize(v) for k, v in self.samples.items()},
+            'errors': self.errors,
+        }
+
+    def write(self, path):
+        write_json(path, self.to_dict())
+        for bench in sorted(self.samples.keys()):
+            s = summarize(self.samples[bench])
+            print('%-45s p50=%10.1f p90=%10.1f p99=%10.1f %s' % (
+                bench, s['p50'], s['p90'], s['p99'], self.unit))
+        for bench in sorted(self.errors.keys()):
+            print('%-45s ERROR %s' % (bench, self.errors[bench]))
@@ -0,0 +1,36 @@
+extends Node
+
+# Godot -> Python calls (i.e. `PyInstance::call`) can only be measured from
+# the Godot side, so time them here and hand the samples to the python runner.
+
+const BATCHES = 20
+const BATCH_SIZE = 20000
+
+
+func _time_calls(runner, target, arity):
+	for b in range(BATCHES):
+		var start = OS.get_ticks_msec()
+		if arity == 0:
+			for i in range(BATCH_SIZE):
+				target.noop0()
+		elif arity == 1:
+			for i in range(BATCH_SIZE):
+				target.noop1(1)
+		elif arity == 2:
+			for i in range(BATCH_SIZE):
+				target.noop2(1, 2)
+		else:
+			for i in range(BATCH_SIZE):
+				target.noop3(1, 2, 3)
+		var elapsed = OS.get_ticks_msec() - start
+		# Milliseconds resolution, hence the big batches
+		runner.add_sample("godot_to_python.call_arity_%s" % arity, elapsed * 1000000.0 / BATCH_SIZE)
+
+
+func _ready():
+	var runner = get_node("Runner")
+	var target = get_node("Target")
+	for arity in range(4):
+		_time_calls(runner, target, arity)
+	runner.run()
+	get_tree().quit()
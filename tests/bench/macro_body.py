@@ -0,0 +1,17 @@
+from godot import exposed
+from godot.bindings import RigidBody2D, Vector2
+
+
+@exposed
+class MacroBody(RigidBody2D):
+    # Godot returns plain wrappers (not the script instance) for nodes,
+    # so count on the class to read it back from the scene root
+    integrations = 0
+
+    def _integrate_forces(self, state):
+        MacroBody.integrations += 1
+        velocity = state.get_linear_velocity()
+        # Bounce back up once fallen far enough
+        if self.get_pos().y > 600:
+            velocity = Vector2(velocity.x, -abs(velocity.y))
+        state.set_linear_velocity(velocity)
@@ -0,0 +1,23 @@
+extends Node
+
+# Signals are emitted by GDScript (as most of our gameplay code does) and
+# received by python listeners.
+
+const LISTENERS = 200
+const EMITS_PER_FRAME = 50
+
+signal storm(value)
+
+
+func _ready():
+	var scene = load("res://macro_listener.tscn")
+	for i in range(LISTENERS):
+		var listener = scene.instance()
+		add_child(listener)
+		connect("storm", listener, "on_storm")
+	set_process(true)
+
+
+func _process(delta):
+	for i in range(EMITS_PER_FRAME):
+		emit_signal("storm", i)
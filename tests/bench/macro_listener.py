@@ -0,0 +1,11 @@
+from godot import exposed
+from godot.bindings import Node
+
+
+@exposed
+class MacroListener(Node):
+    # Counted on the class, see `MacroBody`
+    received = 0
+
+    def on_storm(self, value):
+        MacroListener.received += 1
@@ -0,0 +1,17 @@
+from godot import exposed
+from godot.bindings import Node2D, Vector2
+
+
+@exposed
+class MacroMover(Node2D):
+
+    def _ready(self):
+        self.set_process(True)
+        self.speed = 10.0
+        self.direction = 1
+
+    def _process(self, delta):
+        pos = self.get_pos()
+        if pos.x > 1000 or pos.x < 0:
+            self.direction = -self.direction
+        self.set_pos(Vector2(pos.x + self.direction * self.speed * delta, pos.y))
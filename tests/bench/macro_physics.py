@@ -0,0 +1,34 @@
+from godot import exposed
+from godot.bindings import Node2D, ResourceLoader, Vector2
+
+from macro_tools import FrameRecorder
+from macro_body import MacroBody
+
+
+COLUMNS = 40
+ROWS = 25
+
+
+@exposed
+class MacroPhysics(Node2D):
+    """
+    Grid of rigid bodies each with a python `_integrate_forces`.
+    """
+
+    def _ready(self):
+        self.recorder = FrameRecorder('physics')
+        scene = ResourceLoader.load('res://macro_body.tscn')
+        for x in range(COLUMNS):
+            for y in range(ROWS):
+                body = scene.instance()
+                body.set_pos(Vector2(x * 20, y * 20))
+                self.add_child(body)
+        self.set_process(True)
+
+    def _process(self, delta):
+        if self.recorder.tick():
+            self.recorder.write({
+                'bodies': self.get_child_count(),
+                'integrations': MacroBody.integrations,
+            })
+            self.get_tree().quit()
@@ -0,0 +1,25 @@
+from godot import exposed
+from godot.bindings import Node, ResourceLoader
+
+from macro_tools import FrameRecorder
+
+
+@exposed
+class MacroProcess(Node):
+    """
+    `node_count` nodes (taken from the scene's metadata) each doing a
+    little bit of work in their python `_process`.
+    """
+
+    def _ready(self):
+        count = self.get_meta('node_count')
+        self.recorder = FrameRecorder('process_%s' % count)
+        scene = ResourceLoader.load('res://macro_mover.tscn')
+        for _ in range(count):
+            self.add_child(scene.instance())
+        self.set_process(True)
+
+    def _process(self, delta):
+        if self.recorder.tick():
+            self.recorder.write({'node_count': self.get_child_count()})
+            self.get_tree().quit()
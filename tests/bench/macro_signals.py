@@ -0,0 +1,21 @@
+from godot import exposed
+from godot.bindings import Node
+
+from macro_tools import FrameRecorder
+from macro_listener import MacroListener
+
+
+@exposed
+class MacroSignals(Node):
+
+    def _ready(self):
+        self.recorder = FrameRecorder('signals')
+        self.set_process(True)
+
+    def _process(self, delta):
+        if self.recorder.tick():
+            self.recorder.write({
+                'listeners': self.get_node('Hub').get_child_count(),
+                'signals_received': MacroListener.received,
+            })
+            self.get_tree().quit()
@@ -0,0 +1,43 @@
+from godot import exposed
+from godot.bindings import Node, ResourceLoader
+
+from macro_tools import FrameRecorder
+
+
+POPULATION = 500
+CHURN_PER_FRAME = 50
+
+
+@exposed
+class MacroSpawn(Node):
+    """
+    Keep a population of scripted nodes, replacing `CHURN_PER_FRAME` of
+    them each frame: stresses script instance creation, wrappers
+    allocation and the GC.
+    """
+
+    def _ready(self):
+        self.recorder = FrameRecorder('spawn')
+        self.scene = ResourceLoader.load('res://macro_mover.tscn')
+        self.spawned = 0
+        self.alive = []
+        for _ in range(POPULATION):
+            self._spawn()
+        self.set_process(True)
+
+    def _spawn(self):
+        node = self.scene.instance()
+        self.add_child(node)
+        self.alive.append(node)
+        self.spawned += 1
+
+    def _process(self, delta):
+        for _ in range(CHURN_PER_FRAME):
+            self.alive.pop(0).queue_free()
+            self._spawn()
+        if self.recorder.tick():
+            self.recorder.write({
+                'population': POPULATION,
+                'spawned': self.spawned,
+            })
+            self.get_tree().quit()
@@ -0,0 +1,82 @@
+"""
+Frame recording for the macro benchmarks scenes.
+
+Each scene runs a fixed number of frames, the root node calls
+`FrameRecorder.tick` from its `_process` (root is processed first, so the
+time between two ticks covers a whole frame).
+"""
+import gc
+
+from godot import perf
+from godot.bindings import PythonScriptStats
+
+from bench_tools import summarize, write_json
+
+
+WARMUP_FRAMES = 30
+FRAMES = 600
+
+
+class FrameRecorder:
+
+    def __init__(self, name, frames=FRAMES, warmup=WARMUP_FRAMES):
+        self.name = name
+        self.frames = frames
+        self.warmup = warmup
+        self.frame_times = []
+        self.gc_collections = 0
+        self.gc_pause_usec = 0
+        self.gc_max_frame_pause_usec = 0
+        self.heap_peak = 0
+        self._last_tick = None
+        self._last_alloc = 0
+        self._last_gc_count = 0
+        self._last_gc_pause = 0
+
+    def tick(self):
+        """
+        Return True once all the frames have been recorded.
+        """
+        now = perf.ticks_usec()
+        alloc = gc.mem_alloc()
+        gc_count = PythonScriptStats.get_gc_count()
+        gc_pause = PythonScriptStats.get_gc_total_pause_usec()
+        if self._last_tick is not None:
+            if self.warmup:
+                self.warmup -= 1
+            else:
+                self.frame_times.append((now - self._last_tick) / 1000)
+                self.gc_collections += gc_count - self._last_gc_count
+                frame_pause = gc_pause - self._last_gc_pause
+                self.gc_pause_usec += frame_pause
+                self.gc_max_frame_pause_usec = max(self.gc_max_frame_pause_usec, frame_pause)
+                self.heap_peak = max(self.heap_peak, alloc, self._last_alloc)
+        self._last_tick = now
+        self._last_alloc = alloc
+        self._last_gc_count = gc_count
+        self._last_gc_pause = gc_pause
+        return len(self.frame_times) >= self.frames
+
+    def write(self, stats=None):
+        if not gc.isenabled():
+            print('%s: automatic GC is disabled, collections and pauses only '
+                  'account for explicit gc.collect() calls' % self.name)
+        write_json('bench_macro_%s.json' % self.name, {
+            'suite': 'macro',
+            'scene': self.name,
+            'unit': 'ms',
+            'frames': len(self.frame_times),
+            'frame_time': summarize(self.frame_times),
+            'gc': {
+                # Automatic collection is disabled at init (see
+                # PyLanguage::init), only explicit `gc.collect()` counts then
+                'auto_collect': gc.isenabled(),
+                'collections': self.gc_collections,
+                'pause_total_usec': self.gc_pause_usec,
+                'pause_max_frame_usec': self.gc_max_frame_pause_usec,
+                'heap_peak': self.heap_peak,
+                'heap_size': gc.mem_alloc() + gc.mem_free(),
+            },
+            'perf_counters': perf.get_counters() if perf.enabled else None,
+            'stats': stats or {},
+        })
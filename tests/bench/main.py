@@ -0,0 +1,184 @@
+from godot import exposed
+from godot.bindings import (
+    Node, Object, LineEdit, Geometry, VS, NodePath,
+    Vector2, Vector3, Rect2, Rect3, Plane, Color)
+
+from bench_tools import Report, time_batches
+
+
+OUTPUT = 'bench_results.json'
+BATCHES = 30
+BATCH_SIZE = 2000
+
+
+def _bench_python_to_godot(report):
+    le = LineEdit()
+    a, b, c = Vector2(0, 0), Vector2(1, 0), Vector2(0, 1)
+
+    def arity_0(n):
+        for _ in range(n):
+            le.is_secret()
+
+    def arity_1(n):
+        for _ in range(n):
+            le.set_secret(True)
+
+    def arity_2(n):
+        for _ in range(n):
+            le.set_meta('key', 1)
+
+    def arity_3(n):
+        for _ in range(n):
+            Geometry.get_closest_point_to_segment_2d(a, b, c)
+
+    def arity_4(n):
+        for _ in range(n):
+            Geometry.segment_intersects_circle(a, b, c, 1.0)
+
+    for name, fn in (('python_to_godot.call_arity_0', arity_0),
+                     ('python_to_godot.call_arity_1', arity_1),
+                     ('python_to_godot.call_arity_2', arity_2),
+                     ('python_to_godot.call_arity_3', arity_3),
+                     ('python_to_godot.call_arity_4', arity_4)):
+        _run(report, name, fn)
+    le.free()
+
+
+def _bench_properties(report):
+    le = LineEdit()
+
+    def get(n):
+        for _ in range(n):
+            le.max_length
+
+    def set(n):
+        for _ in range(n):
+            le.max_length = 42
+
+    _run(report, 'property.get', get)
+    _run(report, 'property.set', set)
+    le.free()
+
+
+def _bench_builtins(report):
+    v2 = Vector2(1, 2)
+    v3 = Vector3(1, 2, 3)
+
+    def vector2_new(n):
+        for _ in range(n):
+            Vector2(1, 2)
+
+    def vector2_neg(n):
+        for _ in range(n):
+            -v2
+
+    def vector2_eq(n):
+        for _ in range(n):
+            v2 == v2
+
+    def vector2_dot(n):
+        for _ in range(n):
+            v2.dot(v2)
+
+    def vector2_attr(n):
+        for _ in range(n):
+            v2.x
+
+    def vector3_new(n):
+        for _ in range(n):
+            Vector3(1, 2, 3)
+
+    def vector3_neg(n):
+        for _ in range(n):
+            -v3
+
+    def vector3_cross(n):
+        for _ in range(n):
+            v3.cross(v3)
+
+    def vector3_attr(n):
+        for _ in range(n):
+            v3.x
+
+    for name, fn in (('builtins.vector2_new', vector2_new),
+                     ('builtins.vector2_neg', vector2_neg),
+                     ('builtins.vector2_eq', vector2_eq),
+                     ('builtins.vector2_dot', vector2_dot),
+                     ('builtins.vector2_attr', vector2_attr),
+                     ('builtins.vector3_new', vector3_new),
+                     ('builtins.vector3_neg', vector3_neg),
+                     ('builtins.vector3_cross', vector3_cross),
+                     ('builtins.vector3_attr', vector3_attr)):
+        _run(report, name, fn)
+
+
+def _bench_conversions(report):
+    # `set_meta` converts python -> Variant, `get_meta` Variant -> python
+    holder = Object()
+    values = (
+        ('nil', None),
+        ('bool', True),
+        ('int', 42),
+        ('real', 4.2),
+        ('string', 'foo'),
+        ('vector2', Vector2(1, 2)),
+        ('rect2', Rect2(1, 2, 3, 4)),
+        ('vector3', Vector3(1, 2, 3)),
+        ('plane', Plane(0, 1, 0, 2)),
+        ('rect3', Rect3(Vector3(1, 2, 3), Vector3(4, 5, 6))),
+        ('color', Color(1, 0, 0)),
+        ('node_path', NodePath('a/b')),
+        ('rid', VS.canvas_item_create()),
+        ('object', Object()),
+    )
+    for type_name, value in values:
+
+        def to_godot(n):
+            for _ in range(n):
+                holder.set_meta('key', value)
+
+        def to_python(n):
+            for _ in range(n):
+                holder.get_meta('key')
+
+        _run(report, 'conversion.%s_to_godot' % type_name, to_godot)
+        _run(report, 'conversion.%s_to_python' % type_name, to_python)
+    # Server resources outlive their python wrapper
+    holder.set_meta('key', None)
+    VS.free_rid(dict(values)['rid'])
+
+
+def _bench_baseline(report):
+    # Cost of the benchmark loop itself, to be subtracted from the others
+
+    def empty(n):
+        for _ in range(n):
+            pass
+
+    _run(report, 'baseline.empty_loop', empty)
+
+
+def _run(report, name, fn):
+    try:
+        report.add_samples(name, time_batches(fn, BATCHES, BATCH_SIZE))
+    except Exception as exc:
+        report.add_error(name, exc)
+
+
+@exposed
+class Runner(Node):
+
+    def _ready(self):
+        self.report = Report('micro', 'ns/op')
+
+    def add_sample(self, name, value):
+        self.report.add_sample(name, value)
+
+    def run(self):
+        for bench in (_bench_baseline,
+                      _bench_python_to_godot,
+                      _bench_properties,
+                      _bench_builtins,
+                      _bench_conversions):
+            bench(self.report)
+        self.report.write(OUTPUT)
@@ -0,0 +1,18 @@
+from godot import exposed
+from godot.bindings import Node
+
+
+@exposed
+class Target(Node):
+
+    def noop0(self):
+        pass
+
+    def noop1(self, a):
+        pass
+
+    def noop2(self, a, b):
+        pass
+
+    def noop3(self, a, b, c):
+        pass
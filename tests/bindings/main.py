@@ -13,6 +13,18 @@ class Node(Node):
         test_mods = (
             'test_vector2',
             'test_vector3',
+            'test_rect2',
+            'test_rect3',
+            'test_plane',
+            'test_color',
+            'test_node_path',
+            'test_rid',
+            'test_bulk',
+            'test_native',
+            'test_tier_up',
+            'test_perf',
+            'test_stats',
+            'test_script',
             'test_dynamic_bindings',
         )
         # Run tests here
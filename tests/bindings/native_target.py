@@ -0,0 +1,28 @@
+# Only compiles where the native emitter is enabled (see MICROPY_EMIT_X64
+# in mpconfigport.h), hence kept out of test_native
+
+
+@micropython.native
+def native_add(a, b):
+    return a + b
+
+
+@micropython.viper
+def viper_sum_bytes(buf) -> int:
+    p = ptr8(buf)
+    n = int(len(buf))
+    total = 0
+    for i in range(n):
+        total += p[i]
+    return total
+
+
+class Accumulator:
+
+    def __init__(self):
+        self.total = 0
+
+    @micropython.native
+    def add(self, value):
+        self.total += value
+        return self.total
@@ -0,0 +1,68 @@
+import unittest
+from array import array
+
+from godot.bindings import (MultiMesh, Color, multimesh_set_instance_transforms,
+                            multimesh_get_instance_transforms)
+
+
+IDENTITY = (1, 0, 0, 0, 1, 0, 0, 0, 1, 0, 0, 0)
+
+
+def scaled(factor, x, y, z):
+    return (factor, 0, 0, 0, factor, 0, 0, 0, factor, x, y, z)
+
+
+class TestBulk(unittest.TestCase):
+
+    def setUp(self):
+        self.mm = MultiMesh()
+        self.mm.set_instance_count(3)
+
+    def read_transforms(self):
+        transforms = array('f', IDENTITY * 3)
+        self.assertEqual(multimesh_get_instance_transforms(self.mm, transforms), 3)
+        return list(transforms)
+
+    def test_transforms(self):
+        transforms = array('f', scaled(2, 1, 2, 3) + scaled(0.5, 4, 5, 6) + (0, 1, 0, -1, 0, 0, 0, 0, 1, 7, 8, 9))
+        self.assertEqual(multimesh_set_instance_transforms(self.mm, transforms), 3)
+        self.assertEqual(self.read_transforms(), list(transforms))
+        # Less transforms than instances is allowed
+        transforms = array('d', IDENTITY * 2)
+        self.assertEqual(multimesh_set_instance_transforms(self.mm, transforms), 2)
+        self.assertEqual(self.read_transforms(),
+                         list(IDENTITY * 2 + (0, 1, 0, -1, 0, 0, 0, 0, 1, 7, 8, 9)))
+        # Rid is also accepted
+        transforms = array('f', scaled(3, 0, 0, 1))
+        self.assertEqual(multimesh_set_instance_transforms(self.mm.get_rid(), memoryview(transforms)), 1)
+        self.assertEqual(self.read_transforms()[:12], list(transforms))
+
+    def test_colors(self):
+        transforms = array('f', IDENTITY * 3)
+        colors = array('f', (1, 0, 0, 1, 0, 1, 0, 0.5, 0, 0, 1, 0.25))
+        self.assertEqual(multimesh_set_instance_transforms(self.mm, transforms, colors), 3)
+        self.assertEqual(self.mm.get_instance_color(0), Color(1, 0, 0, 1))
+        self.assertEqual(self.mm.get_instance_color(1), Color(0, 1, 0, 0.5))
+        self.assertEqual(self.mm.get_instance_color(2), Color(0, 0, 1, 0.25))
+        read_colors = array('d', (0,) * 12)
+        self.assertEqual(multimesh_get_instance_transforms(self.mm, transforms, read_colors), 3)
+        self.assertEqual(list(read_colors), list(colors))
+        # Colors are left untouched without a buffer
+        self.assertEqual(multimesh_set_instance_transforms(self.mm, transforms, None), 3)
+        self.assertEqual(self.mm.get_instance_color(1), Color(0, 1, 0, 0.5))
+
+    def test_bad_params(self):
+        self.assertRaises(TypeError, multimesh_set_instance_transforms, 42, array('f', IDENTITY))
+        self.assertRaises(TypeError, multimesh_set_instance_transforms, self.mm, array('i', IDENTITY))
+        self.assertRaises(TypeError, multimesh_set_instance_transforms, self.mm, 42)
+        self.assertRaises(ValueError, multimesh_set_instance_transforms, self.mm, array('f', (1, 2, 3)))
+        self.assertRaises(ValueError, multimesh_set_instance_transforms, self.mm, array('f', IDENTITY * 4))
+        self.assertRaises(ValueError, multimesh_set_instance_transforms,
+                          self.mm, array('f', IDENTITY), array('f', (1, 0, 0, 1) * 2))
+        # Reading back needs writable buffers
+        self.assertRaises(TypeError, multimesh_get_instance_transforms, self.mm, array('i', IDENTITY))
+        self.assertRaises(ValueError, multimesh_get_instance_transforms, self.mm, array('f', IDENTITY * 4))
+
+
+if __name__ == '__main__':
+    unittest.main()
@@ -0,0 +1,67 @@
+import unittest
+
+from godot.bindings import Color
+
+
+class TestColor(unittest.TestCase):
+
+    def test_base(self):
+        c = Color()
+        self.assertEqual(type(c), Color)
+        c2 = Color(1, 0.5, 0)
+        self.assertEqual(type(c2), Color)
+        self.assertEqual(c2, Color(1, 0.5, 0, 1))
+        self.assertNotEqual(c, c2)
+
+    def test_instanciate(self):
+        c = Color(1, 0.5, 0.25, 0.75)
+        self.assertEqual(c.r, 1)
+        self.assertEqual(c.g, 0.5)
+        self.assertEqual(c.b, 0.25)
+        self.assertEqual(c.a, 0.75)
+        self.assertEqual(Color('#ff0000'), Color(1, 0, 0))
+        self.assertRaises(ValueError, Color, 'not a color')
+        self.assertRaises(TypeError, Color, "a", 2, 3)
+        self.assertRaises(TypeError, Color, 1, 2)
+
+    def test_methods(self):
+        c = Color()
+        # Don't test methods' validity but bindings one
+        for field, ret_type, params in (
+                ['blend', Color, (c, )],
+                ['contrasted', Color, ()],
+                ['gray', float, ()],
+                ['inverted', Color, ()],
+                ['linear_interpolate', Color, (c, 0.5)],
+                ['to_32', int, ()],
+                ['to_ARGB32', int, ()],
+                ['to_html', str, ()],
+                ['to_html', str, (False, )]):
+            self.assertTrue(hasattr(c, field), msg='`Color` has no method `%s`' % field)
+            method = getattr(c, field)
+            self.assertTrue(callable(method))
+            ret = method(*params)
+            self.assertEqual(type(ret), ret_type, msg="`Color.%s` is expected to return `%s`" % (field, ret_type))
+
+    def test_blending(self):
+        black = Color(0, 0, 0)
+        white = Color(1, 1, 1)
+        self.assertEqual(black.linear_interpolate(white, 0.5), Color(0.5, 0.5, 0.5))
+        self.assertEqual(black.blend(white), white)
+        self.assertEqual(black.blend(Color(1, 1, 1, 0)), black)
+        self.assertEqual(black.inverted(), white)
+
+    def test_properties(self):
+        c = Color()
+        for field in ('r', 'g', 'b', 'a'):
+            self.assertTrue(hasattr(c, field), msg='`Color` has no property `%s`' % field)
+            self.assertEqual(type(getattr(c, field)), float)
+            for val in (0, 1, 0.5):
+                setattr(c, field, val)
+                self.assertEqual(getattr(c, field), val)
+        for field in ('h', 's', 'v'):
+            self.assertEqual(type(getattr(c, field)), float)
+
+
+if __name__ == '__main__':
+    unittest.main()
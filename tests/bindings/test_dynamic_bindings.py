@@ -12,6 +12,21 @@ class TestDynamicBindings(unittest.TestCase):
         ml = Engine.get_main_loop()
         self.assertTrue(isinstance(ml, Object))
 
+    def test_bind_on_access(self):
+        # Tests run with `python_script/lazy_bindings` enabled
+        from godot import bindings
+        self.assertTrue(issubclass(bindings.Sprite, Node))
+        self.assertIs(bindings.Sprite, bindings.Sprite)
+        self.assertEqual(bindings.KEY_ESCAPE, KEY_ESCAPE)
+        with self.assertRaises(AttributeError):
+            bindings.NotAGodotClass
+
+    def test_singleton_bind_on_access(self):
+        # `VisualServer` is both a class and a singleton, the latter wins
+        from godot import bindings
+        self.assertTrue(isinstance(bindings.VisualServer, bindings.Object))
+        self.assertTrue(callable(bindings.VisualServer.canvas_item_create))
+
     def test_constants(self):
         self.assertEqual(OK, 0)
         self.assertEqual(FAILED, 1)
@@ -53,6 +68,13 @@ class TestDynamicBindings(unittest.TestCase):
         v.set_secret(True)
         self.assertEqual(v.is_secret(), True)
 
+    def test_default_arguments(self):
+        # `add_child(node, legible_unique_name=False)`
+        parent = Node()
+        parent.add_child(Node())
+        self.assertEqual(parent.get_child_count(), 1)
+        parent.free()
+
     def test_class_signals(self):
         pass
 
@@ -0,0 +1,44 @@
+import unittest
+from array import array
+
+from godot.bindings import Marshalls
+
+
+try:
+    from native_target import native_add, viper_sum_bytes, Accumulator
+    HAS_NATIVE_EMITTER = True
+except SyntaxError:
+    HAS_NATIVE_EMITTER = False
+
+
+def roundtrip(value):
+    return Marshalls.base64_to_variant(Marshalls.variant_to_base64(value))
+
+
+class TestNative(unittest.TestCase):
+
+    @unittest.skipUnless(HAS_NATIVE_EMITTER, 'no native emitter on this platform')
+    def test_native(self):
+        self.assertEqual(native_add(1, 2), 3)
+        self.assertEqual(native_add('a', 'b'), 'ab')
+        acc = Accumulator()
+        acc.add(2)
+        self.assertEqual(acc.add(3), 5)
+
+    @unittest.skipUnless(HAS_NATIVE_EMITTER, 'no native emitter on this platform')
+    def test_viper_pool_byte_array(self):
+        raw = Marshalls.base64_to_raw('AQID')
+        self.assertEqual(type(raw), bytearray)
+        self.assertEqual(viper_sum_bytes(raw), 6)
+        self.assertEqual(Marshalls.raw_to_base64(raw), 'AQID')
+
+    def test_pool_arrays(self):
+        ints = roundtrip(array('i', (1, 2, 3)))
+        self.assertEqual(type(ints), array)
+        self.assertEqual(list(ints), [1, 2, 3])
+        reals = roundtrip(array('f', (1.5, 2.5)))
+        self.assertEqual(list(reals), [1.5, 2.5])
+
+
+if __name__ == '__main__':
+    unittest.main()
@@ -0,0 +1,66 @@
+import unittest
+
+from godot.bindings import NodePath, Node
+
+
+class TestNodePath(unittest.TestCase):
+
+    def test_base(self):
+        p = NodePath()
+        self.assertEqual(type(p), NodePath)
+        self.assertTrue(p.is_empty())
+        p2 = NodePath("a/b/c")
+        self.assertEqual(type(p2), NodePath)
+        self.assertEqual(p2, NodePath("a/b/c"))
+        self.assertEqual(p2, NodePath(p2))
+        self.assertNotEqual(p, p2)
+        self.assertEqual(hash(p2), hash(NodePath("a/b/c")))
+        self.assertEqual(str(p2), "a/b/c")
+
+    def test_instanciate(self):
+        self.assertRaises(TypeError, NodePath, 42)
+        self.assertRaises(TypeError, NodePath, "a", "b")
+
+    def test_methods(self):
+        p = NodePath("/root/a/b:c")
+        # Don't test methods' validity but bindings one
+        for field, ret_type, params in (
+                ['get_name', str, (0, )],
+                ['get_name_count', int, ()],
+                ['get_property', str, ()],
+                ['get_subname_count', int, ()],
+                ['is_absolute', bool, ()],
+                ['is_empty', bool, ()]):
+            self.assertTrue(hasattr(p, field), msg='`NodePath` has no method `%s`' % field)
+            method = getattr(p, field)
+            self.assertTrue(callable(method))
+            ret = method(*params)
+            self.assertEqual(type(ret), ret_type, msg="`NodePath.%s` is expected to return `%s`" % (field, ret_type))
+        self.assertTrue(p.is_absolute())
+        self.assertEqual(p.get_name_count(), 3)
+        self.assertEqual(p.get_name(1), "a")
+        self.assertRaises(IndexError, p.get_name, 3)
+
+    def test_explicit_del(self):
+        p = NodePath("a/b")
+        p.__del__()
+        # Calling it again (or letting the GC do so) must be harmless
+        p.__del__()
+        self.assertTrue(p.is_empty())
+
+    def test_get_node(self):
+        parent = Node()
+        child = Node()
+        child.set_name("child")
+        parent.add_child(child)
+        # Same literal twice to go through the parsed paths cache
+        for _ in range(2):
+            self.assertTrue(parent.has_node("child"))
+            self.assertEqual(parent.get_node("child"), child)
+        self.assertEqual(parent.get_node(NodePath("child")), child)
+        self.assertEqual(child.get_path_to(child), NodePath("."))
+        parent.free()
+
+
+if __name__ == '__main__':
+    unittest.main()
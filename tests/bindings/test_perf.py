@@ -0,0 +1,49 @@
+import unittest
+
+from godot import perf
+from godot.bindings import LineEdit
+
+
+class TestPerf(unittest.TestCase):
+
+    def test_counters(self):
+        self.assertEqual(type(perf.enabled), bool)
+        counters = perf.get_counters()
+        for name in ('instance_call', 'method_call', 'property_get',
+                     'property_set', 'wrapper_alloc', 'exception'):
+            self.assertEqual(type(counters[name]), int)
+
+    def test_current_frame_counters(self):
+        perf.reset()
+        v = LineEdit()
+        v.set_secret(True)
+        v.is_secret()
+        v.max_length = 42
+        counters = perf.get_counters(True)
+        conversions = perf.get_conversions(True)
+        self.assertEqual(sorted(conversions.keys()), ['to_godot', 'to_python'])
+        if perf.enabled:
+            self.assertEqual(counters['method_call'], 2)
+            self.assertEqual(counters['property_set'], 1)
+            self.assertEqual(counters['wrapper_alloc'], 1)
+            self.assertEqual(conversions['to_python']['bool'], 1)
+            self.assertEqual(conversions['to_godot']['bool'], 1)
+        else:
+            self.assertEqual(sum(counters.values()), 0)
+            self.assertEqual(conversions['to_python'], {})
+
+    def test_reset(self):
+        LineEdit().is_secret()
+        perf.reset()
+        self.assertEqual(sum(perf.get_counters(True).values()), 0)
+        self.assertEqual(sum(perf.get_counters().values()), 0)
+
+    def test_ticks_usec(self):
+        t1 = perf.ticks_usec()
+        t2 = perf.ticks_usec()
+        self.assertEqual(type(t1), int)
+        self.assertTrue(t2 >= t1)
+
+
+if __name__ == '__main__':
+    unittest.main()
@@ -0,0 +1,58 @@
+import unittest
+
+from godot.bindings import Plane, Vector3
+
+
+class TestPlane(unittest.TestCase):
+
+    def test_base(self):
+        p = Plane()
+        self.assertEqual(type(p), Plane)
+        p2 = Plane(0, 1, 0, 2)
+        self.assertEqual(type(p2), Plane)
+        self.assertEqual(p2, Plane(Vector3(0, 1, 0), 2))
+        self.assertNotEqual(p, p2)
+
+    def test_instanciate(self):
+        p = Plane(Vector3(0, 1, 0), 2)
+        self.assertEqual(p.normal, Vector3(0, 1, 0))
+        self.assertEqual(p.d, 2)
+        self.assertRaises(TypeError, Plane, "a", 2)
+        self.assertRaises(TypeError, Plane, Vector3(), "b")
+        self.assertRaises(TypeError, Plane, 1, 2, 3)
+
+    def test_methods(self):
+        v = Vector3()
+        p = Plane(0, 1, 0, 0)
+        # Don't test methods' validity but bindings one
+        for field, ret_type, params in (
+                ['center', Vector3, ()],
+                ['distance_to', float, (v, )],
+                ['get_any_point', Vector3, ()],
+                ['has_point', bool, (v, )],
+                ['has_point', bool, (v, 0.1)],
+                ['is_point_over', bool, (v, )],
+                ['normalized', Plane, ()],
+                ['project', Vector3, (v, )]):
+            self.assertTrue(hasattr(p, field), msg='`Plane` has no method `%s`' % field)
+            method = getattr(p, field)
+            self.assertTrue(callable(method))
+            ret = method(*params)
+            self.assertEqual(type(ret), ret_type, msg="`Plane.%s` is expected to return `%s`" % (field, ret_type))
+
+    def test_distance(self):
+        p = Plane(Vector3(0, 1, 0), 2)
+        self.assertEqual(p.distance_to(Vector3(0, 5, 0)), 3)
+        self.assertTrue(p.is_point_over(Vector3(0, 5, 0)))
+        self.assertTrue(p.has_point(Vector3(42, 2, 0)))
+        self.assertEqual(p.intersects_segment(Vector3(0, 0, 0), Vector3(0, 10, 0)), Vector3(0, 2, 0))
+        self.assertEqual(p.intersects_segment(Vector3(0, 3, 0), Vector3(0, 10, 0)), None)
+
+    def test_unary(self):
+        p = Plane(0, 1, 0, 2)
+        self.assertEqual(-p, Plane(0, -1, 0, -2))
+        self.assertEqual(+p, p)
+
+
+if __name__ == '__main__':
+    unittest.main()
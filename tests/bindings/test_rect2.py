@@ -0,0 +1,72 @@
+import unittest
+
+from godot.bindings import Rect2, Vector2
+
+
+class TestRect2(unittest.TestCase):
+
+    def test_base(self):
+        r = Rect2()
+        self.assertEqual(type(r), Rect2)
+        r2 = Rect2(1, 2, 3, 4)
+        self.assertEqual(type(r2), Rect2)
+        self.assertEqual(r2, Rect2(Vector2(1, 2), Vector2(3, 4)))
+        self.assertNotEqual(r, r2)
+
+    def test_instanciate(self):
+        r = Rect2(1, 2, 3, 4)
+        self.assertEqual(r.pos, Vector2(1, 2))
+        self.assertEqual(r.size, Vector2(3, 4))
+        self.assertEqual(r.end, Vector2(4, 6))
+        self.assertRaises(TypeError, Rect2, "a", 2, 3, 4)
+        self.assertRaises(TypeError, Rect2, Vector2(), "b")
+        self.assertRaises(TypeError, Rect2, 1)
+
+    def test_methods(self):
+        v = Vector2()
+        r = Rect2()
+        # Don't test methods' validity but bindings one
+        for field, ret_type, params in (
+                ['clip', Rect2, (r, )],
+                ['distance_to', float, (v, )],
+                ['encloses', bool, (r, )],
+                ['expand', Rect2, (v, )],
+                ['get_area', float, ()],
+                ['grow', Rect2, (0.5, )],
+                ['has_no_area', bool, ()],
+                ['has_point', bool, (v, )],
+                ['intersects', bool, (r, )],
+                ['merge', Rect2, (r, )]):
+            self.assertTrue(hasattr(r, field), msg='`Rect2` has no method `%s`' % field)
+            method = getattr(r, field)
+            self.assertTrue(callable(method))
+            ret = method(*params)
+            self.assertEqual(type(ret), ret_type, msg="`Rect2.%s` is expected to return `%s`" % (field, ret_type))
+
+    def test_intersections(self):
+        a = Rect2(0, 0, 10, 10)
+        b = Rect2(5, 5, 10, 10)
+        c = Rect2(20, 20, 1, 1)
+        self.assertTrue(a.intersects(b))
+        self.assertFalse(a.intersects(c))
+        self.assertTrue(a.encloses(Rect2(1, 1, 2, 2)))
+        self.assertFalse(a.encloses(b))
+        self.assertEqual(a.merge(b), Rect2(0, 0, 15, 15))
+        self.assertTrue(a.has_point(Vector2(5, 5)))
+        self.assertFalse(a.has_point(Vector2(-1, 5)))
+
+    def test_properties(self):
+        r = Rect2()
+        for field, ret_type in (
+                ('pos', Vector2),
+                ('size', Vector2)):
+            self.assertTrue(hasattr(r, field), msg='`Rect2` has no property `%s`' % field)
+            field_val = getattr(r, field)
+            self.assertEqual(type(field_val), ret_type, msg="`Rect2.%s` is expected to be a `%s`" % (field, ret_type))
+            val = Vector2(10, 42.5)
+            setattr(r, field, val)
+            self.assertEqual(getattr(r, field), val)
+
+
+if __name__ == '__main__':
+    unittest.main()
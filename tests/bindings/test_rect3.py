@@ -0,0 +1,64 @@
+import unittest
+
+from godot.bindings import Rect3, Vector3, Plane
+
+
+class TestRect3(unittest.TestCase):
+
+    def test_base(self):
+        r = Rect3()
+        self.assertEqual(type(r), Rect3)
+        r2 = Rect3(Vector3(1, 2, 3), Vector3(4, 5, 6))
+        self.assertEqual(type(r2), Rect3)
+        self.assertEqual(r2, Rect3(Vector3(1, 2, 3), Vector3(4, 5, 6)))
+        self.assertNotEqual(r, r2)
+
+    def test_instanciate(self):
+        r = Rect3(Vector3(1, 2, 3), Vector3(4, 5, 6))
+        self.assertEqual(r.pos, Vector3(1, 2, 3))
+        self.assertEqual(r.size, Vector3(4, 5, 6))
+        self.assertEqual(r.end, Vector3(5, 7, 9))
+        self.assertRaises(TypeError, Rect3, "a", Vector3())
+        self.assertRaises(TypeError, Rect3, Vector3(), 2)
+        self.assertRaises(TypeError, Rect3, Vector3())
+
+    def test_methods(self):
+        v = Vector3()
+        r = Rect3()
+        # Don't test methods' validity but bindings one
+        for field, ret_type, params in (
+                ['encloses', bool, (r, )],
+                ['expand', Rect3, (v, )],
+                ['get_area', float, ()],
+                ['get_longest_axis', Vector3, ()],
+                ['get_shortest_axis', Vector3, ()],
+                ['grow', Rect3, (0.5, )],
+                ['has_no_area', bool, ()],
+                ['has_no_surface', bool, ()],
+                ['has_point', bool, (v, )],
+                ['intersection', Rect3, (r, )],
+                ['intersects', bool, (r, )],
+                ['intersects_plane', bool, (Plane(), )],
+                ['intersects_segment', bool, (v, v)],
+                ['merge', Rect3, (r, )]):
+            self.assertTrue(hasattr(r, field), msg='`Rect3` has no method `%s`' % field)
+            method = getattr(r, field)
+            self.assertTrue(callable(method))
+            ret = method(*params)
+            self.assertEqual(type(ret), ret_type, msg="`Rect3.%s` is expected to return `%s`" % (field, ret_type))
+
+    def test_intersections(self):
+        a = Rect3(Vector3(0, 0, 0), Vector3(10, 10, 10))
+        b = Rect3(Vector3(5, 5, 5), Vector3(10, 10, 10))
+        c = Rect3(Vector3(20, 20, 20), Vector3(1, 1, 1))
+        self.assertTrue(a.intersects(b))
+        self.assertFalse(a.intersects(c))
+        self.assertTrue(a.encloses(Rect3(Vector3(1, 1, 1), Vector3(2, 2, 2))))
+        self.assertFalse(a.encloses(b))
+        self.assertEqual(a.merge(b), Rect3(Vector3(0, 0, 0), Vector3(15, 15, 15)))
+        self.assertTrue(a.has_point(Vector3(5, 5, 5)))
+        self.assertFalse(a.has_point(Vector3(-1, 5, 5)))
+
+
+if __name__ == '__main__':
+    unittest.main()
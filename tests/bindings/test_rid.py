@@ -0,0 +1,41 @@
+import unittest
+
+from godot.bindings import RID, VS
+
+
+class TestRID(unittest.TestCase):
+
+    def test_base(self):
+        r = RID()
+        self.assertEqual(type(r), RID)
+        self.assertFalse(r.is_valid())
+        self.assertFalse(r)
+        self.assertEqual(r.get_id(), 0)
+        self.assertEqual(r, RID())
+        self.assertRaises(TypeError, RID, 42)
+
+    def test_server_rids(self):
+        r1 = VS.canvas_item_create()
+        r2 = VS.canvas_item_create()
+        try:
+            self.assertEqual(type(r1), RID)
+            self.assertTrue(r1.is_valid())
+            self.assertTrue(r1)
+            self.assertNotEqual(r1, r2)
+            self.assertNotEqual(r1, RID())
+            self.assertNotEqual(r1, r1.get_id())
+            self.assertTrue(r1 < r2 or r2 < r1)
+            self.assertTrue(r1 <= r1 and r1 >= r1)
+            # RIDs can be used as dict keys
+            d = {r1: 1, r2: 2}
+            self.assertEqual(d[r1], 1)
+            self.assertEqual(d[r2], 2)
+            # Passing a RID back to the server
+            VS.canvas_item_set_parent(r2, r1)
+        finally:
+            VS.free_rid(r2)
+            VS.free_rid(r1)
+
+
+if __name__ == '__main__':
+    unittest.main()
@@ -0,0 +1,17 @@
+import unittest
+
+from godot.bindings import ResourceLoader, OK
+
+
+class TestScript(unittest.TestCase):
+
+    def test_warm_up(self):
+        # main.py is already running, hence already imported
+        script = ResourceLoader.load('res://main.py')
+        self.assertEqual(script.warm_up(), OK)
+        self.assertEqual(script.is_reload_pending(), False)
+        self.assertTrue(script.can_instance())
+
+
+if __name__ == '__main__':
+    unittest.main()
@@ -0,0 +1,48 @@
+import gc
+import unittest
+
+from godot.bindings import PythonScriptStats, Node, Vector2
+
+
+class TestStats(unittest.TestCase):
+
+    def test_heap_info(self):
+        info = PythonScriptStats.get_heap_info()
+        self.assertEqual(sorted(info.keys()), ['free', 'largest_free', 'total', 'used'])
+        self.assertEqual(info['used'] + info['free'], info['total'])
+        self.assertTrue(info['largest_free'] <= info['free'])
+
+    def test_bytecode_size(self):
+        # At least main.py's bytecode has been moved out of the heap
+        self.assertTrue(PythonScriptStats.get_bytecode_size() > 0)
+
+    def test_gc(self):
+        count = PythonScriptStats.get_gc_count()
+        total_pause = PythonScriptStats.get_gc_total_pause_usec()
+        gc.collect()
+        self.assertEqual(PythonScriptStats.get_gc_count(), count + 1)
+        self.assertTrue(PythonScriptStats.get_gc_last_pause_usec() >= 0)
+        self.assertTrue(PythonScriptStats.get_gc_total_pause_usec() >= total_pause)
+
+    def test_object_counts(self):
+        vectors = [Vector2() for _ in range(10)]
+        counts = PythonScriptStats.get_object_counts()
+        self.assertTrue(counts['Vector2'] >= 10)
+        self.assertTrue(counts['list'] >= 1)
+        self.assertTrue('<data>' in counts)
+        sampled = PythonScriptStats.get_object_counts(4)
+        self.assertEqual(type(sampled['<data>']), int)
+
+    def test_wrapper_count(self):
+        nodes = [Node() for _ in range(5)]
+        self.assertTrue(PythonScriptStats.get_wrapper_count() >= 5)
+        for node in nodes:
+            node.free()
+
+    def test_instance_count(self):
+        # At least the test runner's node
+        self.assertTrue(PythonScriptStats.get_instance_count() >= 1)
+
+
+if __name__ == '__main__':
+    unittest.main()
@@ -0,0 +1,34 @@
+import unittest
+
+from godot.bindings import Node, ResourceLoader, PythonScriptStats
+
+
+# Tests run with `python_script/tier_up/threshold` set to 10
+THRESHOLD = 10
+
+
+class TestTierUp(unittest.TestCase):
+
+    def setUp(self):
+        self.node = Node()
+        self.node.set_script(ResourceLoader.load('res://tier_up_target.py'))
+
+    def tearDown(self):
+        self.node.free()
+
+    @unittest.skipUnless(PythonScriptStats.is_tier_up_enabled(), 'tier-up needs a native emitter')
+    def test_hot_method(self):
+        count = PythonScriptStats.get_native_method_count()
+        for i in range(THRESHOLD * 2):
+            self.assertEqual(self.node.call('tick'), i + 1)
+        self.assertEqual(PythonScriptStats.get_native_method_count(), count + 1)
+
+    def test_default_args_stay_in_bytecode(self):
+        count = PythonScriptStats.get_native_method_count()
+        for _ in range(THRESHOLD * 2):
+            self.assertEqual(self.node.call('tick_with_default'), 1)
+        self.assertEqual(PythonScriptStats.get_native_method_count(), count)
+
+
+if __name__ == '__main__':
+    unittest.main()
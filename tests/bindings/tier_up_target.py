@@ -0,0 +1,16 @@
+from godot import exposed
+from godot.bindings import Node
+
+
+calls = []
+
+
+@exposed
+class TierUpTarget(Node):
+
+    def tick(self):
+        calls.append(None)
+        return len(calls)
+
+    def tick_with_default(self, step=1):
+        return step